@@ -0,0 +1,174 @@
+#include "algorithm_compare.h"
+#include "worker_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// One algorithm's run: its own scheduler and simulation over the shared workload
+typedef struct CompareRun {
+    Workload* workload;
+    SchedulerConfig config;
+    int startTime;
+    int endTime;
+    int* waits;               // Wait of every completed flight
+    int waitCount;
+    int waitCapacity;
+    AlgorithmReport* report;
+} CompareRun;
+
+static const char* comparedAlgorithmName(SchedulingAlgorithm algorithm) {
+    switch (algorithm) {
+        case FCFS: return "FCFS";
+        case PRIORITY_SCHED: return "Priority";
+        case SJF: return "SJF";
+        case ROUND_ROBIN: return "Round Robin";
+    }
+    return "?";
+}
+
+// Completion hook: record the flight's wait
+static void recordCompletion(Scheduler* scheduler, Flight* flight, int runwayIndex, void* context) {
+    CompareRun* run = (CompareRun*)context;
+
+    if (run->waitCount == run->waitCapacity) {
+        int newCapacity = run->waitCapacity > 0 ? run->waitCapacity * 2 : 1024;
+        int* waits = (int*)realloc(run->waits, sizeof(int) * newCapacity);
+        if (waits == NULL) return;
+        run->waits = waits;
+        run->waitCapacity = newCapacity;
+    }
+    // Scheduled time to runway assignment, like the scheduler's average wait
+    int wait = scheduler->runways[runwayIndex].occupiedSince - flight->scheduledTime;
+    run->waits[run->waitCount++] = wait > 0 ? wait : 0;
+}
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted values
+static int percentile(int* sorted, int count, int percent) {
+    if (count == 0) return 0;
+    int rank = (count * percent + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+// Worker task: simulate the workload under one algorithm and fill its report
+static void runComparedAlgorithm(void* arg) {
+    CompareRun* run = (CompareRun*)arg;
+    AlgorithmReport* report = run->report;
+    double start = wallClockMs();
+
+    Scheduler* scheduler = createSchedulerWithConfig(run->config);
+    MemoryPool* emergencyPool = createMemoryPool(sizeof(Flight), 64);
+    Simulation* sim = scheduler != NULL ? createSimulation(scheduler) : NULL;
+    if (sim == NULL || emergencyPool == NULL) {
+        freeScheduler(scheduler);
+        destroyMemoryPool(emergencyPool);
+        return;
+    }
+    scheduler->verbose = 0;
+    setSchedulerTime(scheduler, run->startTime);
+    setFlightCompleteHook(scheduler, recordCompletion, run);
+
+    scheduleWorkload(sim, run->workload, emergencyPool);
+    runSimulationUntil(sim, run->endTime);
+    completeDueOperations(scheduler);
+
+    qsort(run->waits, run->waitCount, sizeof(int), compareInts);
+    int minutes = run->endTime - run->startTime;
+    report->processed = scheduler->totalFlightsProcessed;
+    report->waiting = 0;
+    for (FlightIndex i = 0; i < scheduler->flights->count; i++) {
+        if (scheduler->flights->status[i] == WAITING) report->waiting++;
+    }
+    report->averageWait = report->processed > 0 ? (double)scheduler->totalWaitingTime / report->processed : 0.0;
+    report->p95Wait = percentile(run->waits, run->waitCount, 95);
+    report->p99Wait = percentile(run->waits, run->waitCount, 99);
+    report->maxWait = run->waitCount > 0 ? run->waits[run->waitCount - 1] : 0;
+    report->movementsPerHour = minutes > 0 ? report->processed * 60.0 / minutes : 0.0;
+    report->runwayCount = scheduler->runwayCount;
+    for (int r = 0; r < scheduler->runwayCount; r++) {
+        report->handled[r] = scheduler->runways[r].totalFlightsHandled;
+        // From the runway itself: counts flights still on it at endTime and takeoffs held short
+        report->utilization[r] = minutes > 0 ? (double)runwayBusyMinutes(scheduler, r) / minutes : 0.0;
+    }
+    report->emergencies = scheduler->emergencyDispatched;
+    report->averageEmergencyLatency = scheduler->emergencyDispatched > 0
+        ? (double)scheduler->totalEmergencyLatency / scheduler->emergencyDispatched : 0.0;
+    report->maxEmergencyLatency = scheduler->maxEmergencyLatency;
+
+    freeSimulation(sim);
+    freeScheduler(scheduler);
+    destroyMemoryPool(emergencyPool);
+    report->wallMs = wallClockMs() - start;
+}
+
+// Simulate workload from startTime to endTime under all four algorithms in
+// parallel (config supplies runways, dispatch and emergency settings).
+// Returns the number of reports filled.
+int compareAlgorithms(Workload* workload, SchedulerConfig config, int startTime, int endTime, int threads,
+                      AlgorithmReport reports[COMPARED_ALGORITHMS]) {
+    if (workload == NULL || reports == NULL || endTime <= startTime) return 0;
+
+    WorkerPool* workers = createWorkerPool(threads);
+    if (workers == NULL) return 0;
+
+    CompareRun runs[COMPARED_ALGORITHMS];
+    memset(runs, 0, sizeof(runs));
+    memset(reports, 0, sizeof(AlgorithmReport) * COMPARED_ALGORITHMS);
+    for (int a = 0; a < COMPARED_ALGORITHMS; a++) {
+        runs[a].workload = workload;
+        runs[a].config = config;
+        runs[a].config.algorithm = (SchedulingAlgorithm)(FCFS + a);
+        runs[a].config.sharedFlightRecords = 1;
+        runs[a].startTime = startTime;
+        runs[a].endTime = endTime;
+        runs[a].report = &reports[a];
+        reports[a].algorithm = runs[a].config.algorithm;
+        submitWork(workers, runComparedAlgorithm, &runs[a]);
+    }
+    waitForWorkers(workers);
+    freeWorkerPool(workers);
+
+    for (int a = 0; a < COMPARED_ALGORITHMS; a++) {
+        free(runs[a].waits);
+    }
+    return COMPARED_ALGORITHMS;
+}
+
+// Side-by-side report of a comparison
+void displayAlgorithmComparison(AlgorithmReport* reports, int count) {
+    if (reports == NULL || count <= 0) return;
+
+    printf("\n╔═══════════════════════════════════════════════════════════════╗\n");
+    printf("║                    ALGORITHM COMPARISON                       ║\n");
+    printf("╚═══════════════════════════════════════════════════════════════╝\n\n");
+    printf("%-11s | %9s | %7s | %8s | %5s | %5s | %5s | %8s | %11s | %7s | %7s\n",
+           "algorithm", "processed", "waiting", "avg wait", "p95", "p99", "max", "per hour",
+           "emergencies", "avg lat", "max lat");
+    for (int a = 0; a < count; a++) {
+        AlgorithmReport* report = &reports[a];
+        printf("%-11s | %9d | %7d | %8.2f | %5d | %5d | %5d | %8.1f | %11d | %7.2f | %7d\n",
+               comparedAlgorithmName(report->algorithm), report->processed, report->waiting,
+               report->averageWait, report->p95Wait, report->p99Wait, report->maxWait,
+               report->movementsPerHour, report->emergencies, report->averageEmergencyLatency,
+               report->maxEmergencyLatency);
+    }
+
+    printf("\n🛬 Runway utilization (flights handled, share of time occupied):\n");
+    for (int a = 0; a < count; a++) {
+        AlgorithmReport* report = &reports[a];
+        printf("   %-11s", comparedAlgorithmName(report->algorithm));
+        for (int r = 0; r < report->runwayCount; r++) {
+            // Runways past Z are numbered, as in initializeRunways
+            if (r < 26) {
+                printf(" | %c: %d (%.0f%%)", 'A' + r, report->handled[r], report->utilization[r] * 100.0);
+            } else {
+                printf(" | %d: %d (%.0f%%)", r + 1, report->handled[r], report->utilization[r] * 100.0);
+            }
+        }
+        printf("\n");
+    }
+}
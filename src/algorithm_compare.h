@@ -0,0 +1,39 @@
+#ifndef ALGORITHM_COMPARE_H
+#define ALGORITHM_COMPARE_H
+
+#include "scheduler.h"
+#include "workload.h"
+
+#define COMPARED_ALGORITHMS 4
+
+// Algorithm comparison.
+// Runs one workload under FCFS, Priority, SJF and Round Robin at the same
+// time, one scheduler per algorithm on its own worker thread. Every run
+// reads the same flight records (schedulers are created with
+// sharedFlightRecords), so the workload is built once instead of deep-copied
+// per algorithm. Waits (scheduled time to runway assignment) are collected
+// through the completion hook and reported as mean and nearest-rank
+// percentiles.
+typedef struct AlgorithmReport {
+    SchedulingAlgorithm algorithm;
+    int processed;
+    int waiting;              // Flights still queued at the end
+    double averageWait;
+    int p95Wait;
+    int p99Wait;
+    int maxWait;
+    double movementsPerHour;
+    int runwayCount;
+    int handled[MAX_RUNWAYS];
+    double utilization[MAX_RUNWAYS];  // Share of the run each runway was occupied
+    int emergencies;
+    double averageEmergencyLatency;
+    int maxEmergencyLatency;
+    double wallMs;
+} AlgorithmReport;
+
+int compareAlgorithms(Workload* workload, SchedulerConfig config, int startTime, int endTime, int threads,
+                      AlgorithmReport reports[COMPARED_ALGORITHMS]);
+void displayAlgorithmComparison(AlgorithmReport* reports, int count);
+
+#endif
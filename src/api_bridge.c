@@ -4,6 +4,9 @@
 #include <string.h>
 #include <time.h>
 
+// Completed operations listed in stats.json
+#define EXPORT_RECENT_COMPLETIONS 10
+
 // Helper function to escape JSON strings (not used but good to have)
 void escapeJSONString(const char* input, char* output, int maxLen) {
     int j = 0;
@@ -17,7 +20,7 @@ void escapeJSONString(const char* input, char* output, int maxLen) {
 }
 
 // Export flights to JSON
-void exportFlightsJSON(Flight* flights, const char* filename) {
+void exportFlightsJSON(FlightRegistry* registry, const char* filename) {
     FILE* file = fopen(filename, "w");
     if (!file) {
         printf("Error: Cannot open %s for writing\n", filename);
@@ -27,7 +30,7 @@ void exportFlightsJSON(Flight* flights, const char* filename) {
     fprintf(file, "{\n");
     fprintf(file, "  \"flights\": [\n");
     
-    Flight* temp = flights;
+    Flight* temp = registry ? registry->head : NULL;
     int first = 1;
     
     while (temp != NULL) {
@@ -39,9 +42,9 @@ void exportFlightsJSON(Flight* flights, const char* filename) {
         
         fprintf(file, "    {\n");
         fprintf(file, "      \"id\": \"%s\",\n", temp->flightID);
-        fprintf(file, "      \"airline\": \"%s\",\n", temp->airline);
-        fprintf(file, "      \"source\": \"%s\",\n", temp->source);
-        fprintf(file, "      \"destination\": \"%s\",\n", temp->destination);
+        fprintf(file, "      \"airline\": \"%s\",\n", symbolToString(temp->airline));
+        fprintf(file, "      \"source\": \"%s\",\n", symbolToString(temp->source));
+        fprintf(file, "      \"destination\": \"%s\",\n", symbolToString(temp->destination));
         fprintf(file, "      \"scheduledTime\": %d,\n", temp->scheduledTime);
         fprintf(file, "      \"scheduledTimeStr\": \"%s\",\n", timeStr);
         fprintf(file, "      \"priority\": %d,\n", temp->priority);
@@ -57,7 +60,7 @@ void exportFlightsJSON(Flight* flights, const char* filename) {
     }
     
     fprintf(file, "\n  ],\n");
-    fprintf(file, "  \"count\": %d,\n", countFlights(flights));
+    fprintf(file, "  \"count\": %d,\n", countRegistryFlights(registry));
     fprintf(file, "  \"timestamp\": %ld\n", (long)time(NULL));
     fprintf(file, "}\n");
     
@@ -80,16 +83,17 @@ void exportQueuesJSON(Scheduler* scheduler, const char* filename) {
     fprintf(file, "  \"landingQueue\": [\n");
     
     int first = 1;
-    if (scheduler->algorithm == PRIORITY_SCHED) {
-        // Priority queue
-        for (int i = 0; i < scheduler->priorityLandingQueue->size; i++) {
-            Flight* f = scheduler->priorityLandingQueue->flights[i];
+    PriorityQueue* landingHeap = waitingHeapFor(scheduler, LANDING);
+    if (landingHeap != NULL) {
+        // Priority or shortest-job heap
+        for (int i = 0; i < landingHeap->size; i++) {
+            Flight* f = getFlightRecord(scheduler->flights, priorityQueueAt(landingHeap, i));
             if (!first) fprintf(file, ",\n");
             first = 0;
             
             fprintf(file, "    {\n");
             fprintf(file, "      \"id\": \"%s\",\n", f->flightID);
-            fprintf(file, "      \"airline\": \"%s\",\n", f->airline);
+            fprintf(file, "      \"airline\": \"%s\",\n", symbolToString(f->airline));
             fprintf(file, "      \"priority\": %d,\n", f->priority);
             fprintf(file, "      \"priorityStr\": \"%s\",\n", priorityToString(f->priority));
             fprintf(file, "      \"processingTime\": %d\n", f->processingTime);
@@ -97,21 +101,21 @@ void exportQueuesJSON(Scheduler* scheduler, const char* filename) {
         }
     } else {
         // Regular queue
-        QueueNode* node = scheduler->landingQueue->front;
-        while (node != NULL) {
+        Queue* q = scheduler->landingQueue;
+        for (int i = 0; i < q->used; i++) {
+            FlightIndex index = queueAt(q, i);
+            if (index == NO_FLIGHT) continue;
             if (!first) fprintf(file, ",\n");
             first = 0;
             
-            Flight* f = node->flight;
+            Flight* f = getFlightRecord(scheduler->flights, index);
             fprintf(file, "    {\n");
             fprintf(file, "      \"id\": \"%s\",\n", f->flightID);
-            fprintf(file, "      \"airline\": \"%s\",\n", f->airline);
+            fprintf(file, "      \"airline\": \"%s\",\n", symbolToString(f->airline));
             fprintf(file, "      \"priority\": %d,\n", f->priority);
             fprintf(file, "      \"priorityStr\": \"%s\",\n", priorityToString(f->priority));
             fprintf(file, "      \"processingTime\": %d\n", f->processingTime);
             fprintf(file, "    }");
-            
-            node = node->next;
         }
     }
     fprintf(file, "\n  ],\n");
@@ -120,16 +124,17 @@ void exportQueuesJSON(Scheduler* scheduler, const char* filename) {
     fprintf(file, "  \"takeoffQueue\": [\n");
     
     first = 1;
-    if (scheduler->algorithm == PRIORITY_SCHED) {
-        // Priority queue
-        for (int i = 0; i < scheduler->priorityTakeoffQueue->size; i++) {
-            Flight* f = scheduler->priorityTakeoffQueue->flights[i];
+    PriorityQueue* takeoffHeap = waitingHeapFor(scheduler, TAKEOFF);
+    if (takeoffHeap != NULL) {
+        // Priority or shortest-job heap
+        for (int i = 0; i < takeoffHeap->size; i++) {
+            Flight* f = getFlightRecord(scheduler->flights, priorityQueueAt(takeoffHeap, i));
             if (!first) fprintf(file, ",\n");
             first = 0;
             
             fprintf(file, "    {\n");
             fprintf(file, "      \"id\": \"%s\",\n", f->flightID);
-            fprintf(file, "      \"airline\": \"%s\",\n", f->airline);
+            fprintf(file, "      \"airline\": \"%s\",\n", symbolToString(f->airline));
             fprintf(file, "      \"priority\": %d,\n", f->priority);
             fprintf(file, "      \"priorityStr\": \"%s\",\n", priorityToString(f->priority));
             fprintf(file, "      \"processingTime\": %d\n", f->processingTime);
@@ -137,21 +142,21 @@ void exportQueuesJSON(Scheduler* scheduler, const char* filename) {
         }
     } else {
         // Regular queue
-        QueueNode* node = scheduler->takeoffQueue->front;
-        while (node != NULL) {
+        Queue* q = scheduler->takeoffQueue;
+        for (int i = 0; i < q->used; i++) {
+            FlightIndex index = queueAt(q, i);
+            if (index == NO_FLIGHT) continue;
             if (!first) fprintf(file, ",\n");
             first = 0;
             
-            Flight* f = node->flight;
+            Flight* f = getFlightRecord(scheduler->flights, index);
             fprintf(file, "    {\n");
             fprintf(file, "      \"id\": \"%s\",\n", f->flightID);
-            fprintf(file, "      \"airline\": \"%s\",\n", f->airline);
+            fprintf(file, "      \"airline\": \"%s\",\n", symbolToString(f->airline));
             fprintf(file, "      \"priority\": %d,\n", f->priority);
             fprintf(file, "      \"priorityStr\": \"%s\",\n", priorityToString(f->priority));
             fprintf(file, "      \"processingTime\": %d\n", f->processingTime);
             fprintf(file, "    }");
-            
-            node = node->next;
         }
     }
     fprintf(file, "\n  ],\n");
@@ -175,19 +180,21 @@ void exportRunwaysJSON(Scheduler* scheduler, const char* filename) {
     fprintf(file, "{\n");
     fprintf(file, "  \"runways\": [\n");
     
-    for (int i = 0; i < 2; i++) {
+    for (int i = 0; i < scheduler->runwayCount; i++) {
         if (i > 0) fprintf(file, ",\n");
         
         fprintf(file, "    {\n");
         fprintf(file, "      \"name\": \"%s\",\n", scheduler->runways[i].name);
+        fprintf(file, "      \"operations\": \"%s\",\n",
+                runwayOperationsToString(scheduler->runways[i].operations));
         fprintf(file, "      \"occupied\": %s,\n", 
-                scheduler->runways[i].currentFlight ? "true" : "false");
+                scheduler->runways[i].currentFlight != NO_FLIGHT ? "true" : "false");
         
-        if (scheduler->runways[i].currentFlight) {
-            Flight* f = scheduler->runways[i].currentFlight;
+        if (scheduler->runways[i].currentFlight != NO_FLIGHT) {
+            Flight* f = getFlightRecord(scheduler->flights, scheduler->runways[i].currentFlight);
             fprintf(file, "      \"currentFlight\": {\n");
             fprintf(file, "        \"id\": \"%s\",\n", f->flightID);
-            fprintf(file, "        \"airline\": \"%s\",\n", f->airline);
+            fprintf(file, "        \"airline\": \"%s\",\n", symbolToString(f->airline));
             fprintf(file, "        \"operation\": \"%s\"\n", operationToString(f->operation));
             fprintf(file, "      },\n");
         } else {
@@ -244,8 +251,54 @@ void exportStatsJSON(Scheduler* scheduler, const char* filename) {
     fprintf(file, "  \"totalFlightsProcessed\": %d,\n", scheduler->totalFlightsProcessed);
     fprintf(file, "  \"totalWaitingTime\": %d,\n", scheduler->totalWaitingTime);
     fprintf(file, "  \"averageWaitTime\": %.2f,\n", avgWaitTime);
+    // Wait ends when the runway is assigned; turnaround when the operation completes
+    fprintf(file, "  \"averageTurnaroundTime\": %.2f,\n",
+            scheduler->completionStats != NULL && scheduler->completionStats->overall.flights > 0
+                ? (double)scheduler->completionStats->overall.turnaround.total
+                      / scheduler->completionStats->overall.flights : 0.0);
+    // runwayAHandled/runwayBHandled stay for the dashboard; runwayHandled covers every runway
     fprintf(file, "  \"runwayAHandled\": %d,\n", scheduler->runways[0].totalFlightsHandled);
-    fprintf(file, "  \"runwayBHandled\": %d,\n", scheduler->runways[1].totalFlightsHandled);
+    fprintf(file, "  \"runwayBHandled\": %d,\n",
+            scheduler->runwayCount > 1 ? scheduler->runways[1].totalFlightsHandled : 0);
+    fprintf(file, "  \"emergencyDispatched\": %d,\n", scheduler->emergencyDispatched);
+    fprintf(file, "  \"averageEmergencyLatency\": %.2f,\n",
+            scheduler->emergencyDispatched > 0
+                ? (double)scheduler->totalEmergencyLatency / scheduler->emergencyDispatched : 0.0);
+    fprintf(file, "  \"maxEmergencyLatency\": %d,\n", scheduler->maxEmergencyLatency);
+    fprintf(file, "  \"emergencyPreemptions\": %d,\n", scheduler->emergencyPreemptions);
+    fprintf(file, "  \"runwayCount\": %d,\n", scheduler->runwayCount);
+    fprintf(file, "  \"runwayHandled\": [");
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        fprintf(file, "%s%d", i > 0 ? ", " : "", scheduler->runways[i].totalFlightsHandled);
+    }
+    fprintf(file, "],\n");
+    // Wait/turnaround percentiles overall and per runway, operation, priority, emergency type, airline
+    writeCompletionStatsJSON(scheduler->completionStats, file);
+    // Latest completions, newest first, from the completion log's ring
+    fprintf(file, "  \"recentCompletions\": [");
+    for (int age = 0; age < EXPORT_RECENT_COMPLETIONS; age++) {
+        const CompletedOperation* record = recentCompletion(scheduler->completionLog, age);
+        if (record == NULL) break;
+        char completedStr[10];
+        timeToString(record->completedAt, completedStr);
+        fprintf(file, "%s\n    {\"flightID\": \"%s\", \"airline\": \"%s\", \"operation\": \"%s\", "
+                      "\"runway\": \"%s\", \"completedAt\": %d, \"completedAtStr\": \"%s\"}",
+                age > 0 ? "," : "", record->flightID, symbolToString(record->airline),
+                operationToString((Operation)record->operation),
+                scheduler->runways[record->runwayIndex].name, record->completedAt, completedStr);
+    }
+    fprintf(file, "\n  ],\n");
+#ifdef ENABLE_PROFILING
+    // Hot-path latencies per phase (profiling builds only)
+    fprintf(file, "  \"phaseLatency\": {\n");
+    for (int p = 0; p < PROFILE_PHASES; p++) {
+        PhaseSummary summary = summarizePhase(&scheduler->profile, (ProfilePhase)p);
+        fprintf(file, "    \"%s\": {\"samples\": %llu, \"p50Ns\": %.0f, \"p99Ns\": %.0f, \"maxNs\": %.0f}%s\n",
+                phaseToString((ProfilePhase)p), summary.samples, summary.p50Ns, summary.p99Ns, summary.maxNs,
+                p + 1 < PROFILE_PHASES ? "," : "");
+    }
+    fprintf(file, "  },\n");
+#endif
     fprintf(file, "  \"timestamp\": %ld\n", (long)time(NULL));
     fprintf(file, "}\n");
     
@@ -253,12 +306,14 @@ void exportStatsJSON(Scheduler* scheduler, const char* filename) {
 }
 
 // Export all data in one call - THIS IS THE MAIN FUNCTION YOU'LL USE!
-void exportAllDataJSON(Scheduler* scheduler, Flight* allFlights) {
+void exportAllDataJSON(Scheduler* scheduler, FlightRegistry* registry) {
     if (!scheduler) {
         printf("Warning: Scheduler is NULL, cannot export data\n");
         return;
     }
     
+    PROFILE_START(exporting);
+    
     // Create data directory if it doesn't exist
     #ifdef _WIN32
         system("if not exist data mkdir data");
@@ -267,10 +322,11 @@ void exportAllDataJSON(Scheduler* scheduler, Flight* allFlights) {
     #endif
     
     // Export all data files
-    exportFlightsJSON(allFlights, "data/flights.json");
+    exportFlightsJSON(registry, "data/flights.json");
     exportQueuesJSON(scheduler, "data/queues.json");
     exportRunwaysJSON(scheduler, "data/runways.json");
     exportStatsJSON(scheduler, "data/stats.json");
+    PROFILE_STOP(&scheduler->profile, PHASE_EXPORT, exporting);
     
     // Optional: Print confirmation (comment out if too verbose)
     // printf("📤 Data exported to JSON files\n");
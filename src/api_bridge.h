@@ -2,6 +2,7 @@
 #define API_BRIDGE_H
 
 #include "scheduler.h"
+#include "registry.h"
 
 // API Bridge functions for C to Web communication
 
@@ -9,7 +10,7 @@
 void exportSystemStateJSON(Scheduler* scheduler, const char* filename);
 
 // Write flight data to JSON
-void exportFlightsJSON(Flight* flights, const char* filename);
+void exportFlightsJSON(FlightRegistry* registry, const char* filename);
 
 // Write queue data to JSON
 void exportQueuesJSON(Scheduler* scheduler, const char* filename);
@@ -24,9 +25,9 @@ void exportStatsJSON(Scheduler* scheduler, const char* filename);
 void exportLogJSON(Scheduler* scheduler, const char* filename);
 
 // Main function to export all data
-void exportAllDataJSON(Scheduler* scheduler, Flight* allFlights);
+void exportAllDataJSON(Scheduler* scheduler, FlightRegistry* registry);
 
 // Start HTTP server mode
-void startServerMode(Scheduler* scheduler, Flight* allFlights, int port);
+void startServerMode(Scheduler* scheduler, FlightRegistry* registry, int port);
 
 #endif
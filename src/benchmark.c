@@ -0,0 +1,1513 @@
+// ============================================================================
+//  Airport Runway System - Benchmarks
+//  Build and run with: make -f Makefile.simple bench
+//  benchmark [--suite] [--json <file>]
+//    --suite        Only the tracked suite (fixed seeds, median of repeats)
+//    --json <file>  Also write the suite's results to file as JSON
+// ============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+    #include <windows.h>
+    #include <direct.h>
+    #define chdir _chdir
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#include "flight.h"
+#include "flight_table.h"
+#include "registry.h"
+#include "queue.h"
+#include "scheduler.h"
+#include "simulation.h"
+#include "multi_airport.h"
+#include "algorithm_compare.h"
+#include "workload_generator.h"
+#include "api_bridge.h"
+
+// Monotonic clock in nanoseconds
+static double benchNowNs() {
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart * 1e9 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+// Small deterministic generator so runs are repeatable
+static unsigned int benchRandom(unsigned int* state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static Flight** makeBenchFlights(MemoryPool* pool, int n) {
+    Flight** flights = (Flight**)malloc(sizeof(Flight*) * n);
+    char id[50];
+    for (int i = 0; i < n; i++) {
+        sprintf(id, "FL%07d", i);
+        flights[i] = createPooledFlight(pool, id, "BenchAir", "AAA", "BBB", i % 1440,
+                                        (Priority)(1 + i % 3), (Operation)(i % 2), 5 + i % 6);
+    }
+    return flights;
+}
+
+// ==================== FLIGHT REGISTRY ====================
+
+static void benchRegistry(int n) {
+    FlightRegistry* registry = createFlightRegistry();
+    Flight** flights = makeBenchFlights(registry->flightPool, n);
+    char id[50];
+    unsigned int seed = 12345;
+    int lookups = 100000;
+    int hits = 0;
+
+    double start = benchNowNs();
+    for (int i = 0; i < n; i++) {
+        addFlightToRegistry(registry, flights[i]);
+    }
+    double insertNs = (benchNowNs() - start) / n;
+
+    start = benchNowNs();
+    for (int i = 0; i < lookups; i++) {
+        sprintf(id, "FL%07d", (int)(benchRandom(&seed) % (unsigned int)n));
+        if (findFlightInRegistry(registry, id) != NULL) hits++;
+    }
+    double lookupNs = (benchNowNs() - start) / lookups;
+
+    // Linear list search for comparison (fewer probes, it is O(n) per lookup)
+    int listLookups = n > 10000 ? 200 : 2000;
+    start = benchNowNs();
+    for (int i = 0; i < listLookups; i++) {
+        sprintf(id, "FL%07d", (int)(benchRandom(&seed) % (unsigned int)n));
+        if (findFlight(registry->head, id) != NULL) hits++;
+    }
+    double listNs = (benchNowNs() - start) / listLookups;
+
+    printf("%10d | %12.1f | %12.1f | %14.1f | %d\n",
+           n, insertNs, lookupNs, listNs, countRegistryFlights(registry));
+
+    freeFlightRegistry(registry);
+    free(flights);
+    (void)hits;
+}
+
+// Table of n flights with random scheduling fields
+static FlightTable* makeBenchTable(MemoryPool* pool, int n, unsigned int seed) {
+    FlightTable* table = createFlightTable(n);
+    char id[50];
+    for (int i = 0; i < n; i++) {
+        sprintf(id, "FL%07d", i);
+        Flight* flight = createPooledFlight(pool, id, "BenchAir", "AAA", "BBB",
+                                            (int)(benchRandom(&seed) % 1440),
+                                            (Priority)(1 + benchRandom(&seed) % 3),
+                                            (Operation)(benchRandom(&seed) % 2),
+                                            5 + (int)(benchRandom(&seed) % 6));
+        if (benchRandom(&seed) % 20 == 0) {
+            flight->emergencyType = (EmergencyType)(1 + benchRandom(&seed) % 4);
+        }
+        addFlightToTable(table, flight);
+    }
+    return table;
+}
+
+// ==================== PRIORITY QUEUE FAN-OUT ====================
+
+static void benchHeap(FlightTable* table, int depth, int arity) {
+    PriorityQueue* pq = createPriorityQueueWithArity(table, arity);
+    reservePriorityQueue(pq, depth);
+    unsigned int seed = 777;
+    int holdOps = 200000;
+    for (int i = 0; i < table->count; i++) {
+        refreshFlightFromRecord(table, i);    // Undo the previous run's hold phase
+    }
+
+    double start = benchNowNs();
+    for (int i = 0; i < depth; i++) {
+        insertPriorityQueue(pq, i);
+    }
+    double insertNs = (benchNowNs() - start) / depth;
+
+    // Hold model: queue depth stays constant while flights cycle through
+    start = benchNowNs();
+    for (int i = 0; i < holdOps; i++) {
+        FlightIndex flight = extractMin(pq);
+        table->scheduledTime[flight] += 1 + (int)(benchRandom(&seed) % 60);
+        insertPriorityQueue(pq, flight);
+    }
+    double holdNs = (benchNowNs() - start) / holdOps;
+
+    start = benchNowNs();
+    while (!isPriorityQueueEmpty(pq)) {
+        extractMin(pq);
+    }
+    double extractNs = (benchNowNs() - start) / depth;
+
+    printf("%8d | %5d | %10.1f | %10.1f | %14.1f\n", depth, arity, insertNs, extractNs, holdNs);
+    freePriorityQueue(pq);
+}
+
+// ==================== PACKED KEYS VS FIELD COMPARISONS ====================
+
+// The previous ordering: three dependent comparisons through the table
+static int fieldCompare(FlightTable* table, FlightIndex a, FlightIndex b) {
+    if (table->emergencyType[a] != table->emergencyType[b]) {
+        return table->emergencyType[b] - table->emergencyType[a];
+    }
+    if (table->priority[a] != table->priority[b]) {
+        return table->priority[b] - table->priority[a];
+    }
+    return table->scheduledTime[a] - table->scheduledTime[b];
+}
+
+// 4-ary heap of bare flight handles ordered by fieldCompare (the old layout)
+static void fieldHeapInsert(FlightTable* table, FlightIndex* heap, int* size, FlightIndex flight) {
+    int index = (*size)++;
+    while (index > 0) {
+        int parent = (index - 1) / 4;
+        if (fieldCompare(table, flight, heap[parent]) >= 0) break;
+        heap[index] = heap[parent];
+        index = parent;
+    }
+    heap[index] = flight;
+}
+
+static FlightIndex fieldHeapExtract(FlightTable* table, FlightIndex* heap, int* size) {
+    FlightIndex top = heap[0];
+    FlightIndex flight = heap[--(*size)];
+    int index = 0;
+    while (1) {
+        int first = 4 * index + 1;
+        if (first >= *size) break;
+        int last = first + 4 < *size ? first + 4 : *size;
+        int smallest = first;
+        for (int child = first + 1; child < last; child++) {
+            if (fieldCompare(table, heap[child], heap[smallest]) < 0) smallest = child;
+        }
+        if (fieldCompare(table, heap[smallest], flight) >= 0) break;
+        heap[index] = heap[smallest];
+        index = smallest;
+    }
+    heap[index] = flight;
+    return top;
+}
+
+static void benchPackedKeys(FlightTable* table, int depth) {
+    FlightIndex* heap = (FlightIndex*)malloc(sizeof(FlightIndex) * depth);
+    int size = 0;
+    
+    double start = benchNowNs();
+    for (int i = 0; i < depth; i++) fieldHeapInsert(table, heap, &size, i);
+    double fieldInsertNs = (benchNowNs() - start) / depth;
+    start = benchNowNs();
+    while (size > 0) fieldHeapExtract(table, heap, &size);
+    double fieldExtractNs = (benchNowNs() - start) / depth;
+    free(heap);
+    
+    PriorityQueue* pq = createPriorityQueue(table);
+    reservePriorityQueue(pq, depth);
+    start = benchNowNs();
+    for (int i = 0; i < depth; i++) insertPriorityQueue(pq, i);
+    double keyInsertNs = (benchNowNs() - start) / depth;
+    start = benchNowNs();
+    while (!isPriorityQueueEmpty(pq)) extractMin(pq);
+    double keyExtractNs = (benchNowNs() - start) / depth;
+    freePriorityQueue(pq);
+    
+    printf("%8d | %13.1f | %13.1f | %11.1f | %11.1f\n",
+           depth, fieldInsertNs, fieldExtractNs, keyInsertNs, keyExtractNs);
+}
+
+// ==================== HEAP VS BUCKET QUEUE ====================
+
+static void benchQueueBackend(FlightTable* table, int depth, PriorityQueueKind kind) {
+    PriorityQueue* pq = kind == BUCKET_QUEUE ? createBucketPriorityQueue(table) : createPriorityQueue(table);
+    reservePriorityQueue(pq, depth);
+    unsigned int seed = 4242;
+    int holdOps = 200000;
+    for (int i = 0; i < table->count; i++) {
+        refreshFlightFromRecord(table, i);
+    }
+    
+    double start = benchNowNs();
+    for (int i = 0; i < depth; i++) insertPriorityQueue(pq, i);
+    double insertNs = (benchNowNs() - start) / depth;
+    
+    // Hold model with arrivals later in the day than the flight just served
+    start = benchNowNs();
+    for (int i = 0; i < holdOps; i++) {
+        FlightIndex flight = extractMin(pq);
+        int later = table->scheduledTime[flight] + 1 + (int)(benchRandom(&seed) % 60);
+        table->scheduledTime[flight] = later < 1440 ? later : 1439;
+        insertPriorityQueue(pq, flight);
+    }
+    double holdNs = (benchNowNs() - start) / holdOps;
+    
+    start = benchNowNs();
+    while (!isPriorityQueueEmpty(pq)) extractMin(pq);
+    double extractNs = (benchNowNs() - start) / depth;
+    
+    printf("%8d | %-6s | %10.1f | %10.1f | %14.1f\n",
+           depth, kind == BUCKET_QUEUE ? "bucket" : "heap", insertNs, extractNs, holdNs);
+    freePriorityQueue(pq);
+}
+
+// ==================== FIFO QUEUE: RING BUFFER VS LINKED ====================
+
+// The previous node-per-flight queue, kept here only for comparison
+typedef struct LinkedNode {
+    FlightIndex flight;
+    struct LinkedNode* next;
+} LinkedNode;
+
+typedef struct LinkedQueue {
+    LinkedNode* front;
+    LinkedNode* rear;
+    int size;
+} LinkedQueue;
+
+static void linkedEnqueue(LinkedQueue* q, FlightIndex flight) {
+    LinkedNode* node = (LinkedNode*)malloc(sizeof(LinkedNode));
+    node->flight = flight;
+    node->next = NULL;
+    if (q->rear == NULL) {
+        q->front = q->rear = node;
+    } else {
+        q->rear->next = node;
+        q->rear = node;
+    }
+    q->size++;
+}
+
+static FlightIndex linkedDequeue(LinkedQueue* q) {
+    LinkedNode* node = q->front;
+    FlightIndex flight = node->flight;
+    q->front = node->next;
+    if (q->front == NULL) q->rear = NULL;
+    free(node);
+    q->size--;
+    return flight;
+}
+
+static void benchQueue(int n) {
+    int holdOps = 1000000;
+    long long checksum = 0;
+    
+    // Ring buffer
+    Queue* ring = createQueue();
+    double start = benchNowNs();
+    for (int i = 0; i < n; i++) enqueue(ring, i);
+    double ringEnqueueNs = (benchNowNs() - start) / n;
+    
+    start = benchNowNs();
+    for (int i = 0; i < holdOps; i++) enqueue(ring, dequeue(ring));
+    double ringHoldNs = (benchNowNs() - start) / holdOps;
+    
+    start = benchNowNs();
+    for (int i = 0; i < ring->used; i++) checksum += queueAt(ring, i);
+    double ringScanNs = (benchNowNs() - start) / n;
+    
+    start = benchNowNs();
+    while (!isQueueEmpty(ring)) checksum += dequeue(ring);
+    double ringDequeueNs = (benchNowNs() - start) / n;
+    freeQueue(ring);
+    
+    // Linked list
+    LinkedQueue linked = {NULL, NULL, 0};
+    start = benchNowNs();
+    for (int i = 0; i < n; i++) linkedEnqueue(&linked, i);
+    double linkedEnqueueNs = (benchNowNs() - start) / n;
+    
+    start = benchNowNs();
+    for (int i = 0; i < holdOps; i++) linkedEnqueue(&linked, linkedDequeue(&linked));
+    double linkedHoldNs = (benchNowNs() - start) / holdOps;
+    
+    start = benchNowNs();
+    for (LinkedNode* node = linked.front; node != NULL; node = node->next) checksum += node->flight;
+    double linkedScanNs = (benchNowNs() - start) / n;
+    
+    start = benchNowNs();
+    while (linked.size > 0) checksum += linkedDequeue(&linked);
+    double linkedDequeueNs = (benchNowNs() - start) / n;
+    
+    printf("%8d | %-6s | %8.1f | %8.1f | %8.1f | %8.2f\n",
+           n, "ring", ringEnqueueNs, ringDequeueNs, ringHoldNs, ringScanNs);
+    printf("%8d | %-6s | %8.1f | %8.1f | %8.1f | %8.2f\n",
+           n, "linked", linkedEnqueueNs, linkedDequeueNs, linkedHoldNs, linkedScanNs);
+    (void)checksum;
+}
+
+// ==================== SJF: QUEUE SCAN VS SHORTEST-JOB HEAP ====================
+
+// Hold model on a backlog of n flights: take the shortest job, give it a new
+// processing time and queue it again
+static void benchShortestJob(int n) {
+    FlightTable* table = createFlightTable(n);
+    MemoryPool* pool = createMemoryPool(sizeof(Flight), 1024);
+    unsigned int seed = 4242;
+    char id[50];
+    for (int i = 0; i < n; i++) {
+        sprintf(id, "SJF%07d", i);
+        addFlightToTable(table, createPooledFlight(pool, id, "BenchAir", "AAA", "BBB", i,
+                                                   SCHEDULED, LANDING, 1 + (int)(benchRandom(&seed) % 60)));
+    }
+    int ops = 20000000 / n;
+    if (ops > 200000) ops = 200000;
+    
+    // Old scheduleSJF: scan the FIFO queue for the minimum, remove it
+    Queue* q = createQueue();
+    for (int i = 0; i < n; i++) enqueue(q, i);
+    double start = benchNowNs();
+    for (int op = 0; op < ops; op++) {
+        FlightIndex shortest = NO_FLIGHT;
+        for (int i = 0; i < q->used; i++) {
+            FlightIndex candidate = queueAt(q, i);
+            if (candidate == NO_FLIGHT) continue;
+            if (shortest == NO_FLIGHT || table->processingTime[candidate] < table->processingTime[shortest]) {
+                shortest = candidate;
+            }
+        }
+        removeFromQueue(q, shortest);
+        table->processingTime[shortest] = 1 + (int)(benchRandom(&seed) % 60);
+        enqueue(q, shortest);
+    }
+    double scanNs = (benchNowNs() - start) / ops;
+    freeQueue(q);
+    
+    // Shortest-job heap
+    PriorityQueue* heap = createShortestJobQueue(table, DEFAULT_HEAP_ARITY, 0);
+    for (int i = 0; i < n; i++) insertPriorityQueue(heap, i);
+    start = benchNowNs();
+    for (int op = 0; op < ops; op++) {
+        FlightIndex shortest = extractMin(heap);
+        table->processingTime[shortest] = 1 + (int)(benchRandom(&seed) % 60);
+        insertPriorityQueue(heap, shortest);
+    }
+    double heapNs = (benchNowNs() - start) / ops;
+    freePriorityQueue(heap);
+    
+    printf("%8d | %12.1f | %12.1f | %7.0fx\n", n, scanNs, heapNs, scanNs / heapNs);
+    freeFlightTable(table);
+    destroyMemoryPool(pool);
+}
+
+// ==================== SCHEDULE LOADING: ONE BY ONE VS BULK ====================
+
+// Time to admit a full schedule of n flights into a fresh registry + scheduler
+static double benchStartup(int n, SchedulingAlgorithm algo, int bulk) {
+    Scheduler* scheduler = createScheduler(algo);
+    FlightRegistry* registry = createFlightRegistry();
+    scheduler->registry = registry;
+    scheduler->verbose = 0;
+    
+    unsigned int seed = 2024;
+    char id[50];
+    Flight** flights = (Flight**)malloc(sizeof(Flight*) * n);
+    for (int i = 0; i < n; i++) {
+        sprintf(id, "FL%07d", i);
+        flights[i] = createPooledFlight(registry->flightPool, id, "BenchAir", "AAA", "BBB",
+                                        (int)(benchRandom(&seed) % 1440),
+                                        (Priority)(1 + benchRandom(&seed) % 3),
+                                        (Operation)(benchRandom(&seed) % 2), 5);
+    }
+    
+    double start = benchNowNs();
+    if (bulk) {
+        addFlightsToSchedulerBulk(scheduler, flights, n);
+    } else {
+        for (int i = 0; i < n; i++) {
+            if (addFlightToRegistry(registry, flights[i])) {
+                addFlightToScheduler(scheduler, flights[i]);
+            }
+        }
+    }
+    double elapsedMs = (benchNowNs() - start) / 1e6;
+    
+    free(flights);
+    freeScheduler(scheduler);
+    freeFlightRegistry(registry);
+    return elapsedMs;
+}
+
+// ==================== FULL DAY: EVENT-DRIVEN VS TICK MODE ====================
+
+typedef struct DayResult {
+    int processed;
+    int waiting;
+    int runwayCount;
+    int handled[MAX_RUNWAYS];
+    int oldestWaiting;    // Minutes the longest-waiting unserved flight has waited at the end
+    int emergencies;      // Emergencies given a runway
+    long long emergencyLatency;
+    int worstEmergencyLatency;
+    int preemptions;
+    long steps;
+    double ms;
+} DayResult;
+
+static SchedulerConfig dayConfig(SchedulingAlgorithm algo, int runways, int maxDispatch) {
+    SchedulerConfig config = defaultSchedulerConfig(algo);
+    config.runwayCount = runways;
+    config.maxDispatchPerTick = maxDispatch;
+    return config;
+}
+
+// Simulate a 24-hour day of arrivals from midnight, event-driven or per tick,
+// with in-flight emergencies raised at random times
+static DayResult runBenchDay(int movements, int emergencies, SchedulerConfig config, int eventDriven) {
+    Scheduler* scheduler = createSchedulerWithConfig(config);
+    MemoryPool* pool = createMemoryPool(sizeof(Flight), 1024);
+    Simulation* sim = createSimulation(scheduler);
+    scheduler->verbose = 0;
+    setSchedulerTime(scheduler, 0);
+    
+    unsigned int seed = 31337;
+    char id[50];
+    for (int i = 0; i < movements; i++) {
+        sprintf(id, "DAY%05d", i);
+        int arrival = (int)(benchRandom(&seed) % 1440);
+        Flight* flight = createPooledFlight(pool, id, "BenchAir", "AAA", "BBB", arrival,
+                                            (Priority)(1 + benchRandom(&seed) % 3),
+                                            (Operation)(benchRandom(&seed) % 2),
+                                            1 + (int)(benchRandom(&seed) % 4));
+        scheduleArrival(sim, flight, arrival);
+    }
+    
+    // Separate stream so the regular traffic is the same with or without emergencies
+    unsigned int emergencySeed = 9001;
+    for (int i = 0; i < emergencies; i++) {
+        sprintf(id, "EMG%04d", i);
+        int raisedAt = (int)(benchRandom(&emergencySeed) % 1440);
+        Flight* flight = createPooledFlight(pool, id, "BenchAir", "AAA", "BBB", raisedAt,
+                                            EMERGENCY, LANDING, 5);
+        flight->emergencyType = INFLIGHT_EMERGENCY;
+        scheduleEmergency(sim, flight, raisedAt);
+    }
+    
+    double start = benchNowNs();
+    if (eventDriven) {
+        runSimulationUntil(sim, 1440);
+    } else {
+        runSimulationTicks(sim, 1440);
+    }
+    
+    DayResult result;
+    result.ms = (benchNowNs() - start) / 1e6;
+    result.processed = scheduler->totalFlightsProcessed;
+    result.waiting = scheduler->totalWaitingTime;
+    result.runwayCount = scheduler->runwayCount;
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        result.handled[i] = scheduler->runways[i].totalFlightsHandled;
+    }
+    result.steps = sim->steps;
+    result.emergencies = scheduler->emergencyDispatched;
+    result.emergencyLatency = scheduler->totalEmergencyLatency;
+    result.worstEmergencyLatency = scheduler->maxEmergencyLatency;
+    result.preemptions = scheduler->emergencyPreemptions;
+    result.oldestWaiting = 0;
+    for (FlightIndex i = 0; i < scheduler->flights->count; i++) {
+        int age = scheduler->currentTime - scheduler->flights->scheduledTime[i];
+        if (scheduler->flights->status[i] == WAITING && age > result.oldestWaiting) {
+            result.oldestWaiting = age;
+        }
+    }
+    
+    freeSimulation(sim);
+    freeScheduler(scheduler);
+    destroyMemoryPool(pool);
+    return result;
+}
+
+// One flight per scheduling pass vs filling every free runway
+static void benchDispatch(int movements, int runways, SchedulingAlgorithm algo, const char* name) {
+    DayResult single = runBenchDay(movements, 0, dayConfig(algo, runways, 1), 1);
+    DayResult batch = runBenchDay(movements, 0, dayConfig(algo, runways, 0), 1);
+    double singleWait = single.processed > 0 ? (double)single.waiting / single.processed : 0.0;
+    double batchWait = batch.processed > 0 ? (double)batch.waiting / batch.processed : 0.0;
+    
+    printf("%7d | %-9s | %9d | %9.2f | %9d | %9.2f | %+6.1f%%\n",
+           runways, name, single.processed, singleWait, batch.processed, batchWait,
+           single.processed > 0 ? 100.0 * (batch.processed - single.processed) / single.processed : 0.0);
+}
+
+// Saturated SJF day: how long the oldest unserved flight has waited, by aging rate
+static void benchSjfAging(int movements, int agingRate) {
+    SchedulerConfig config = dayConfig(SJF, DEFAULT_RUNWAY_COUNT, 0);
+    config.sjfAgingRate = agingRate;
+    DayResult day = runBenchDay(movements, 0, config, 1);
+    
+    printf("%6d | %9d | %9d | %8.2f | %13d\n", agingRate, movements, day.processed,
+           day.processed > 0 ? (double)day.waiting / day.processed : 0.0, day.oldestWaiting);
+}
+
+// Emergency response on a busy day, with and without takeoff preemption
+static void benchEmergencyResponse(int movements, int emergencies, SchedulingAlgorithm algo,
+                                   const char* name, int preemption) {
+    SchedulerConfig config = dayConfig(algo, DEFAULT_RUNWAY_COUNT, 0);
+    config.emergencyPreemption = preemption;
+    config.takeoffRollDelay = 3;
+    DayResult ticks = runBenchDay(movements, emergencies, config, 0);
+    DayResult events = runBenchDay(movements, emergencies, config, 1);
+    int same = ticks.processed == events.processed && ticks.waiting == events.waiting &&
+               ticks.emergencyLatency == events.emergencyLatency && ticks.preemptions == events.preemptions;
+    
+    printf("%-9s | %-7s | %6d | %8.2f | %5d | %9d | %8.2f | %s\n", name, preemption ? "on" : "off",
+           events.emergencies,
+           events.emergencies > 0 ? (double)events.emergencyLatency / events.emergencies : 0.0,
+           events.worstEmergencyLatency, events.preemptions,
+           events.processed > 0 ? (double)events.waiting / events.processed : 0.0,
+           same ? "identical" : "DIFFERENT");
+}
+
+// ==================== CONCURRENT SCHEDULERS ====================
+
+#define CONCURRENT_ALGORITHMS 4
+
+typedef struct ConcurrentDay {
+    int movements;
+    int emergencies;
+    DayResult results[CONCURRENT_ALGORITHMS];
+} ConcurrentDay;
+
+static SchedulerConfig concurrentConfig(int algorithm) {
+    SchedulerConfig config = dayConfig((SchedulingAlgorithm)(algorithm + 1), DEFAULT_RUNWAY_COUNT, 0);
+    config.emergencyPreemption = 1;
+    config.takeoffRollDelay = 3;
+    return config;
+}
+
+// Same outcome, ignoring timing
+static int sameDay(DayResult* a, DayResult* b) {
+    return a->processed == b->processed && a->waiting == b->waiting &&
+           a->runwayCount == b->runwayCount &&
+           memcmp(a->handled, b->handled, sizeof(int) * a->runwayCount) == 0 &&
+           a->oldestWaiting == b->oldestWaiting && a->emergencies == b->emergencies &&
+           a->emergencyLatency == b->emergencyLatency &&
+           a->worstEmergencyLatency == b->worstEmergencyLatency &&
+           a->preemptions == b->preemptions && a->steps == b->steps;
+}
+
+// Thread body: one private scheduler per algorithm, run back to back
+#ifdef _WIN32
+static DWORD WINAPI concurrentDayThread(LPVOID arg) {
+#else
+static void* concurrentDayThread(void* arg) {
+#endif
+    ConcurrentDay* day = (ConcurrentDay*)arg;
+    for (int a = 0; a < CONCURRENT_ALGORITHMS; a++) {
+        day->results[a] = runBenchDay(day->movements, day->emergencies, concurrentConfig(a), 1);
+    }
+    return 0;
+}
+
+// Run the same day on several threads at once and check every thread
+// matches a single-threaded reference run
+static void benchConcurrentSchedulers(int threads, int movements, int emergencies) {
+    ConcurrentDay reference;
+    reference.movements = movements;
+    reference.emergencies = emergencies;
+    double start = benchNowNs();
+    concurrentDayThread(&reference);
+    double sequentialMs = (benchNowNs() - start) / 1e6;
+    
+    ConcurrentDay* days = (ConcurrentDay*)calloc(threads, sizeof(ConcurrentDay));
+#ifdef _WIN32
+    HANDLE* handles = (HANDLE*)calloc(threads, sizeof(HANDLE));
+#else
+    pthread_t* handles = (pthread_t*)calloc(threads, sizeof(pthread_t));
+#endif
+    if (days == NULL || handles == NULL) {
+        printf("❌ Memory allocation failed for concurrent benchmark!\n");
+        free(days);
+        free(handles);
+        return;
+    }
+    
+    start = benchNowNs();
+    for (int t = 0; t < threads; t++) {
+        days[t].movements = movements;
+        days[t].emergencies = emergencies;
+#ifdef _WIN32
+        handles[t] = CreateThread(NULL, 0, concurrentDayThread, &days[t], 0, NULL);
+#else
+        pthread_create(&handles[t], NULL, concurrentDayThread, &days[t]);
+#endif
+    }
+    for (int t = 0; t < threads; t++) {
+#ifdef _WIN32
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+#else
+        pthread_join(handles[t], NULL);
+#endif
+    }
+    double concurrentMs = (benchNowNs() - start) / 1e6;
+    
+    int mismatches = 0;
+    for (int t = 0; t < threads; t++) {
+        for (int a = 0; a < CONCURRENT_ALGORITHMS; a++) {
+            if (!sameDay(&days[t].results[a], &reference.results[a])) mismatches++;
+        }
+    }
+    
+    printf("%7d | %9d | %11.2f | %13.2f | %s\n", threads, threads * CONCURRENT_ALGORITHMS,
+           sequentialMs, concurrentMs, mismatches == 0 ? "identical" : "DIFFERENT");
+    free(days);
+    free(handles);
+}
+
+// ==================== MULTI-AIRPORT RUNNER ====================
+
+// airports airports with skewed traffic (every fourth one is a hub with
+// 8x the movements) advanced in hourly windows on threads workers
+static void benchMultiAirport(int airports, int baseMovements, int threads, int* firstMovements) {
+    AirportRunner* runner = createAirportRunner(threads);
+    if (runner == NULL) return;
+    runner->windowMinutes = 60;
+    
+    unsigned int seed = 4242;
+    char code[8], id[50];
+    int scheduled = 0;
+    for (int a = 0; a < airports; a++) {
+        sprintf(code, "AP%02d", a);
+        int hub = a % 4 == 0;
+        Airport* airport = addAirport(runner, code, dayConfig(PRIORITY_SCHED, hub ? 6 : 2, 0));
+        if (airport == NULL) continue;
+        int movements = hub ? baseMovements * 8 : baseMovements;
+        for (int i = 0; i < movements; i++) {
+            sprintf(id, "%s%05d", code, i);
+            scheduleAirportFlight(airport, id, "BenchAir", code, "ZZZ", (int)(benchRandom(&seed) % 1440),
+                                  (Priority)(1 + benchRandom(&seed) % 3), (Operation)(benchRandom(&seed) % 2),
+                                  1 + (int)(benchRandom(&seed) % 4));
+        }
+        scheduled += movements;
+    }
+    
+    runAirportsUntil(runner, 1440);
+    int movements = countAirportMovements(runner);
+    if (*firstMovements < 0) *firstMovements = movements;
+    
+    printf("%7d | %8d | %9d | %9d | %8.2f | %12.0f | %6ld | %s\n", threads, airports, scheduled, movements,
+           runner->wallMs, runner->wallMs > 0 ? movements * 1000.0 / runner->wallMs : 0.0,
+           countStolenTasks(runner->workers), movements == *firstMovements ? "same" : "DIFFERENT");
+    freeAirportRunner(runner);
+}
+
+// Coupled network: every takeoff flies to another airport of the runner
+// and lands there flightMinutes later; window 0 = lookahead-sized windows
+static void benchAirportNetwork(int airports, int movements, int flightMinutes, int threads, int window,
+                                long* firstWaiting) {
+    AirportRunner* runner = createAirportRunner(threads);
+    if (runner == NULL) return;
+    runner->windowMinutes = window;
+    
+    char code[8], destination[8], id[50];
+    for (int a = 0; a < airports; a++) {
+        sprintf(code, "NET%d", a);
+        addAirport(runner, code, dayConfig(PRIORITY_SCHED, 2, 0));
+    }
+    connectAirports(runner, flightMinutes);
+    
+    // Departures only: every landing in the run is a flight handed over by another airport
+    unsigned int seed = 777;
+    for (int a = 0; a < airports; a++) {
+        Airport* airport = runner->airports[a];
+        for (int i = 0; i < movements; i++) {
+            int to = (a + 1 + (int)(benchRandom(&seed) % (airports - 1))) % airports;
+            sprintf(id, "%s%05d", airport->code, i);
+            sprintf(destination, "NET%d", to);
+            scheduleAirportFlight(airport, id, "BenchAir", airport->code, destination,
+                                  (int)(benchRandom(&seed) % 1200), (Priority)(1 + benchRandom(&seed) % 3),
+                                  TAKEOFF, 1 + (int)(benchRandom(&seed) % 4));
+        }
+    }
+    
+    runAirportsUntil(runner, 1440);
+    long waiting = 0;
+    for (int a = 0; a < airports; a++) {
+        waiting += runner->airports[a]->scheduler->totalWaitingTime;
+    }
+    if (*firstWaiting < 0) *firstWaiting = waiting;
+    int processed = countAirportMovements(runner);
+    
+    printf("%7d | %6d | %7d | %9d | %9ld | %8.2f | %12.0f | %s\n", threads, window > 0 ? window : runner->lookahead,
+           runner->windowsRun, processed, runner->transfersDelivered, runner->wallMs,
+           runner->wallMs > 0 ? processed * 1000.0 / runner->wallMs : 0.0,
+           waiting == *firstWaiting ? "same" : "DIFFERENT");
+    freeAirportRunner(runner);
+}
+
+// ==================== ALGORITHM COMPARISON ====================
+
+// Busy day with emergencies, shared by every compare run
+static Workload* makeCompareWorkload(int movements, int emergencies) {
+    Workload* workload = createWorkload();
+    if (workload == NULL) return NULL;
+    unsigned int seed = 31337;
+    char id[50];
+    for (int i = 0; i < movements; i++) {
+        sprintf(id, "CMP%05d", i);
+        int arrival = (int)(benchRandom(&seed) % 1440);
+        addWorkloadFlight(workload, id, "BenchAir", "AAA", "BBB", arrival,
+                          (Priority)(1 + benchRandom(&seed) % 3), (Operation)(benchRandom(&seed) % 2),
+                          1 + (int)(benchRandom(&seed) % 4));
+    }
+    unsigned int emergencySeed = 9001;
+    for (int i = 0; i < emergencies; i++) {
+        sprintf(id, "EMG%04d", i);
+        addWorkloadEmergency(workload, id, "BenchAir", "AAA", "BBB", (int)(benchRandom(&emergencySeed) % 1440),
+                             LANDING, 5, INFLIGHT_EMERGENCY);
+    }
+    return workload;
+}
+
+// All four algorithms on one thread vs one thread each; reports must match
+static void benchCompareRunner(int movements, int emergencies, int print) {
+    Workload* workload = makeCompareWorkload(movements, emergencies);
+    if (workload == NULL) return;
+    SchedulerConfig config = dayConfig(FCFS, DEFAULT_RUNWAY_COUNT, 0);
+    config.emergencyPreemption = 1;
+    config.takeoffRollDelay = 3;
+    
+    AlgorithmReport serial[COMPARED_ALGORITHMS], parallel[COMPARED_ALGORITHMS];
+    double start = benchNowNs();
+    compareAlgorithms(workload, config, 0, 1440, 1, serial);
+    double serialMs = (benchNowNs() - start) / 1e6;
+    start = benchNowNs();
+    compareAlgorithms(workload, config, 0, 1440, COMPARED_ALGORITHMS, parallel);
+    double parallelMs = (benchNowNs() - start) / 1e6;
+    
+    int same = 1;
+    for (int a = 0; a < COMPARED_ALGORITHMS; a++) {
+        same = same && serial[a].processed == parallel[a].processed &&
+               serial[a].averageWait == parallel[a].averageWait && serial[a].p99Wait == parallel[a].p99Wait &&
+               serial[a].averageEmergencyLatency == parallel[a].averageEmergencyLatency;
+    }
+    printf("%9d | %11d | %9.2f | %11.2f | %14.1f | %s\n", movements, emergencies, serialMs, parallelMs,
+           movements * sizeof(Flight) / 1024.0 * (COMPARED_ALGORITHMS - 1), same ? "identical" : "DIFFERENT");
+    if (print) displayAlgorithmComparison(parallel, COMPARED_ALGORITHMS);
+    freeWorkload(workload);
+}
+
+// ==================== GENERATED WORKLOADS ====================
+
+static int sameFlight(Flight* a, Flight* b) {
+    return strcmp(a->flightID, b->flightID) == 0 && a->airline == b->airline && a->source == b->source &&
+           a->destination == b->destination && a->scheduledTime == b->scheduledTime &&
+           a->priority == b->priority && a->operation == b->operation &&
+           a->processingTime == b->processingTime && a->emergencyType == b->emergencyType;
+}
+
+static int sameWorkload(Workload* a, Workload* b) {
+    if (a->flightCount != b->flightCount || a->emergencyCount != b->emergencyCount) return 0;
+    for (int i = 0; i < a->flightCount; i++) {
+        if (!sameFlight(a->flights[i], b->flights[i])) return 0;
+    }
+    for (int i = 0; i < a->emergencyCount; i++) {
+        if (!sameFlight(a->emergencies[i].flight, b->emergencies[i].flight)) return 0;
+    }
+    return 1;
+}
+
+// Priority day on every runway: arrivals through the bulk feed, or one
+// heap event per flight. Returns ms; processed gets the flights completed.
+static double runGeneratedDay(Workload* workload, int feed, int* processed) {
+    SchedulerConfig config = dayConfig(PRIORITY_SCHED, MAX_RUNWAYS, 0);
+    config.sharedFlightRecords = 1;
+    Scheduler* scheduler = createSchedulerWithConfig(config);
+    MemoryPool* emergencyPool = createMemoryPool(sizeof(Flight), 64);
+    Simulation* sim = createSimulation(scheduler);
+    scheduler->verbose = 0;
+    setSchedulerTime(scheduler, 0);
+    
+    double start = benchNowNs();
+    if (feed) {
+        scheduleWorkload(sim, workload, emergencyPool);
+    } else {
+        for (int i = 0; i < workload->flightCount; i++) {
+            scheduleArrival(sim, workload->flights[i], workload->flights[i]->scheduledTime);
+        }
+        Workload emergenciesOnly = *workload;
+        emergenciesOnly.flightCount = 0;
+        scheduleWorkload(sim, &emergenciesOnly, emergencyPool);
+    }
+    runSimulationUntil(sim, 1440);
+    completeDueOperations(scheduler);
+    double ms = (benchNowNs() - start) / 1e6;
+    
+    *processed = scheduler->totalFlightsProcessed;
+    freeSimulation(sim);
+    freeScheduler(scheduler);
+    destroyMemoryPool(emergencyPool);
+    return ms;
+}
+
+// Generate n flights twice from one seed, then run the day both ways
+static void benchGeneratedWorkload(int n) {
+    WorkloadSpec spec = defaultWorkloadSpec(n, 2024);
+    double start = benchNowNs();
+    Workload* workload = generateWorkload(&spec);
+    double generateMs = (benchNowNs() - start) / 1e6;
+    Workload* again = generateWorkload(&spec);
+    if (workload == NULL || again == NULL) {
+        freeWorkload(workload);
+        freeWorkload(again);
+        return;
+    }
+    
+    int byEvent = 0, byFeed = 0;
+    double eventMs = runGeneratedDay(workload, 0, &byEvent);
+    double feedMs = runGeneratedDay(workload, 1, &byFeed);
+    printf("%8d | %11d | %8.2f | %9.1f | %-9s | %9.2f | %9.2f | %9d | %s\n",
+           n, workload->emergencyCount, generateMs, generateMs * 1e6 / n,
+           sameWorkload(workload, again) ? "identical" : "DIFFERENT", eventMs, feedMs, byFeed,
+           byEvent == byFeed ? "same" : "DIFFERENT");
+    freeWorkload(workload);
+    freeWorkload(again);
+}
+
+static void benchDay(int movements, SchedulingAlgorithm algo, const char* name) {
+    DayResult ticks = runBenchDay(movements, 0, dayConfig(algo, DEFAULT_RUNWAY_COUNT, 0), 0);
+    DayResult events = runBenchDay(movements, 0, dayConfig(algo, DEFAULT_RUNWAY_COUNT, 0), 1);
+    int same = ticks.processed == events.processed && ticks.waiting == events.waiting &&
+               memcmp(ticks.handled, events.handled, sizeof(int) * ticks.runwayCount) == 0;
+    
+    printf("%9d | %-9s | %6ld | %8.3f | %6ld | %8.3f | %9d | %s\n",
+           movements, name, ticks.steps, ticks.ms, events.steps, events.ms,
+           events.processed, same ? "identical" : "DIFFERENT");
+}
+
+// ==================== COMPLETION STATS ====================
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Cost of folding one completion into every aggregate, and how far the
+// sketch's percentiles are from the exact ones on a long-tailed wait
+static void benchCompletionStats(int completions) {
+    int* waits = (int*)malloc(sizeof(int) * completions);
+    unsigned int seed = 31337;
+    for (int i = 0; i < completions; i++) {
+        // Mostly short waits, a few very long ones
+        waits[i] = (int)(benchRandom(&seed) % 16) << (benchRandom(&seed) % 8);
+    }
+    SymbolID airlines[5] = {internString("AirIndia"), internString("IndiGo"), internString("SpiceJet"),
+                            internString("Vistara"), internString("GoAir")};
+    
+    CompletionStats* stats = createCompletionStats(8);
+    double start = benchNowNs();
+    for (int i = 0; i < completions; i++) {
+        recordCompletedOperation(stats, i & 7, (Operation)(i & 1), (Priority)(SCHEDULED + i % 3),
+                                 (EmergencyType)(i % 5), airlines[i % 5], waits[i], waits[i] + 5);
+    }
+    double ns = (benchNowNs() - start) / completions;
+    
+    qsort(waits, completions, sizeof(int), compareInts);
+    int percents[] = {50, 95, 99};
+    printf("%9d | %9.1f", completions, ns);
+    for (int p = 0; p < 3; p++) {
+        int exact = waits[((long long)completions * percents[p] + 99) / 100 - 1];
+        printf(" | %5d / %-5d", exact, sketchPercentile(&stats->overall.wait, stats->overall.flights, percents[p]));
+    }
+    printf("\n");
+    
+    freeCompletionStats(stats);
+    free(waits);
+}
+
+// ==================== COMPLETION LOG ====================
+
+static void countLoggedCompletion(const CompletedOperation* record, long long sequence, void* context) {
+    (void)record;
+    (void)sequence;
+    (*(long long*)context)++;
+}
+
+// Recording completions: the old completed-flights list (addFlight walks to
+// the tail every time) vs the record log's ring, with and without a spill file
+static void benchCompletionLog(int completions) {
+    MemoryPool* pool = createMemoryPool(sizeof(Flight), 1024);
+    Flight** flights = makeBenchFlights(pool, completions);
+    CompletedOperation* records = (CompletedOperation*)calloc(completions, sizeof(CompletedOperation));
+    for (int i = 0; i < completions; i++) {
+        snprintf(records[i].flightID, sizeof(records[i].flightID), "%s", flights[i]->flightID);
+        records[i].airline = flights[i]->airline;
+        records[i].scheduledTime = flights[i]->scheduledTime;
+        records[i].startedAt = flights[i]->scheduledTime;
+        records[i].completedAt = flights[i]->scheduledTime + flights[i]->processingTime;
+        records[i].runwayIndex = (unsigned char)(i & 1);
+        records[i].operation = (unsigned char)flights[i]->operation;
+        records[i].priority = (unsigned char)flights[i]->priority;
+        records[i].emergencyType = NO_EMERGENCY;
+    }
+    
+    // Quadratic: only run it while it finishes in reasonable time
+    char listNs[16] = "-";
+    if (completions <= 20000) {
+        Flight* completed = NULL;
+        double start = benchNowNs();
+        for (int i = 0; i < completions; i++) addFlight(&completed, flights[i]);
+        snprintf(listNs, sizeof(listNs), "%.1f", (benchNowNs() - start) / completions);
+    }
+    
+    CompletionLog* log = createCompletionLog(COMPLETION_LOG_DEFAULT_CAPACITY);
+    double start = benchNowNs();
+    for (int i = 0; i < completions; i++) appendCompletion(log, &records[i]);
+    double ringNs = (benchNowNs() - start) / completions;
+    freeCompletionLog(log);
+    
+    const char* spillPath = "bench_completions.log";
+    log = createCompletionLog(COMPLETION_LOG_DEFAULT_CAPACITY);
+    double spillNs = 0;
+    long long replayed = 0;
+    if (openCompletionSpill(log, spillPath)) {
+        start = benchNowNs();
+        for (int i = 0; i < completions; i++) appendCompletion(log, &records[i]);
+        spillNs = (benchNowNs() - start) / completions;
+        visitCompletions(log, countLoggedCompletion, &replayed);
+    }
+    freeCompletionLog(log);
+    remove(spillPath);
+    
+    printf("%9d | %11s | %8.1f | %10.1f | %lld of %d\n", completions, listNs, ringNs, spillNs,
+           replayed, completions);
+    
+    free(records);
+    free(flights);
+    destroyMemoryPool(pool);
+}
+
+// ==================== PHASE PROBES ====================
+
+// Cost of one probe pair, then where a generated day's scheduling time goes
+static void benchPhaseProbes(int flights) {
+#ifdef ENABLE_PROFILING
+    PhaseProfile probeProfile;
+    resetPhaseProfile(&probeProfile);
+    int probes = 10000000;
+    unsigned long long ticks = 0;
+    double start = benchNowNs();
+    for (int i = 0; i < probes; i++) {
+        ticks += profileTicks();
+    }
+    double readNs = (benchNowNs() - start) / probes;
+    start = benchNowNs();
+    for (int i = 0; i < probes; i++) {
+        PROFILE_START(probe);
+        PROFILE_STOP(&probeProfile, PHASE_SELECTION, probe);
+    }
+    double pairNs = (benchNowNs() - start) / probes;
+    // Under virtualization the timestamp read itself can cost several times its bare-metal price
+    printf("Timer read: %.2f ns | probe pair (2 reads + histogram update): %.2f ns\n\n", readNs, pairNs);
+    (void)ticks;
+    
+    WorkloadSpec spec = defaultWorkloadSpec(flights, 2024);
+    Workload* workload = generateWorkload(&spec);
+    SchedulerConfig config = dayConfig(PRIORITY_SCHED, 8, 0);
+    config.sharedFlightRecords = 1;
+    Scheduler* scheduler = createSchedulerWithConfig(config);
+    MemoryPool* emergencyPool = createMemoryPool(sizeof(Flight), 64);
+    Simulation* sim = createSimulation(scheduler);
+    scheduler->verbose = 0;
+    setSchedulerTime(scheduler, 0);
+    scheduleWorkload(sim, workload, emergencyPool);
+    runSimulationUntil(sim, 1440);
+    completeDueOperations(scheduler);
+    printf("%d generated flights, Priority on 8 runways (%d completed):\n", flights, scheduler->totalFlightsProcessed);
+    displayPhaseProfile(&scheduler->profile);
+    
+    freeSimulation(sim);
+    freeScheduler(scheduler);
+    destroyMemoryPool(emergencyPool);
+    freeWorkload(workload);
+#else
+    (void)flights;
+    printf("Probes are compiled out; build with make -f Makefile.simple PROFILING=1 bench to time them\n");
+#endif
+}
+
+// ==================== TRACKED SUITE ====================
+
+// Fixed seeds and sizes so results compare across commits. Every case runs
+// SUITE_REPEATS times; the median and best time per operation are kept.
+#define SUITE_REPEATS 7
+#define SUITE_MAX_RESULTS 32
+#define SUITE_FLIGHTS 100000
+#define SUITE_LIST_FLIGHTS 1000
+#define SUITE_SCHEDULED_FLIGHTS 20000
+
+typedef struct SuiteResult {
+    const char* group;        // "micro" or "macro"
+    const char* name;
+    long operations;          // Per repetition
+    double medianNs;          // Per operation
+    double bestNs;
+} SuiteResult;
+
+typedef struct SuiteContext {
+    MemoryPool* pool;
+    FlightTable* table;       // SUITE_FLIGHTS random flights
+    Flight** list;            // SUITE_LIST_FLIGHTS flights linked through next
+    FlightRegistry* registry; // SUITE_FLIGHTS flights
+    char (*ids)[16];          // SUITE_FLIGHTS lookup keys, drawn ahead of time
+    Flight** scheduled;       // SUITE_SCHEDULED_FLIGHTS flights for the schedule* cases
+    SchedulingAlgorithm algorithm;
+} SuiteContext;
+
+// One repetition of a case: returns the nanoseconds timed
+typedef double (*SuiteCase)(SuiteContext* context);
+
+static SuiteResult suiteResults[SUITE_MAX_RESULTS];
+static int suiteResultCount = 0;
+static volatile long long suiteSink;    // Keeps measured results alive
+
+static int compareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void runSuiteCase(const char* group, const char* name, long operations, SuiteCase run,
+                         SuiteContext* context) {
+    double samples[SUITE_REPEATS];
+    for (int r = 0; r < SUITE_REPEATS; r++) {
+        samples[r] = run(context);
+    }
+    qsort(samples, SUITE_REPEATS, sizeof(double), compareDoubles);
+    
+    SuiteResult* result = &suiteResults[suiteResultCount < SUITE_MAX_RESULTS ? suiteResultCount++ : SUITE_MAX_RESULTS - 1];
+    result->group = group;
+    result->name = name;
+    result->operations = operations;
+    result->medianNs = samples[SUITE_REPEATS / 2] / operations;
+    result->bestNs = samples[0] / operations;
+    printf("%-5s | %-20s | %9ld | %14.1f | %12.1f\n",
+           group, name, operations, result->medianNs, result->bestNs);
+}
+
+static double suiteEnqueue(SuiteContext* context) {
+    (void)context;
+    Queue* q = createQueue();
+    double start = benchNowNs();
+    for (int i = 0; i < SUITE_FLIGHTS; i++) enqueue(q, i);
+    double ns = benchNowNs() - start;
+    suiteSink += q->used;
+    freeQueue(q);
+    return ns;
+}
+
+static double suiteDequeue(SuiteContext* context) {
+    (void)context;
+    Queue* q = createQueue();
+    for (int i = 0; i < SUITE_FLIGHTS; i++) enqueue(q, i);
+    double start = benchNowNs();
+    long long sum = 0;
+    for (int i = 0; i < SUITE_FLIGHTS; i++) sum += dequeue(q);
+    double ns = benchNowNs() - start;
+    suiteSink += sum;
+    freeQueue(q);
+    return ns;
+}
+
+static double suiteInsertPriorityQueue(SuiteContext* context) {
+    PriorityQueue* pq = createPriorityQueue(context->table);
+    double start = benchNowNs();
+    for (int i = 0; i < SUITE_FLIGHTS; i++) insertPriorityQueue(pq, i);
+    double ns = benchNowNs() - start;
+    suiteSink += pq->size;
+    freePriorityQueue(pq);
+    return ns;
+}
+
+static double suiteExtractMin(SuiteContext* context) {
+    PriorityQueue* pq = createPriorityQueue(context->table);
+    for (int i = 0; i < SUITE_FLIGHTS; i++) insertPriorityQueue(pq, i);
+    double start = benchNowNs();
+    long long sum = 0;
+    for (int i = 0; i < SUITE_FLIGHTS; i++) sum += extractMin(pq);
+    double ns = benchNowNs() - start;
+    suiteSink += sum;
+    freePriorityQueue(pq);
+    return ns;
+}
+
+static double suiteCompareFlight(SuiteContext* context) {
+    FlightTable* table = context->table;
+    double start = benchNowNs();
+    long long sum = 0;
+    for (int i = 0; i + 1 < SUITE_FLIGHTS; i++) {
+        sum += compareFlight(table->records[i], table->records[i + 1]);
+    }
+    double ns = benchNowNs() - start;
+    suiteSink += sum;
+    return ns;
+}
+
+static double suiteFindFlight(SuiteContext* context) {
+    double start = benchNowNs();
+    long hits = 0;
+    for (int i = 0; i < SUITE_LIST_FLIGHTS; i++) {
+        if (findFlight(context->list[0], context->ids[i]) != NULL) hits++;
+    }
+    double ns = benchNowNs() - start;
+    suiteSink += hits;
+    return ns;
+}
+
+static double suiteFindFlightInRegistry(SuiteContext* context) {
+    double start = benchNowNs();
+    long hits = 0;
+    for (int i = 0; i < SUITE_FLIGHTS; i++) {
+        if (findFlightInRegistry(context->registry, context->ids[i]) != NULL) hits++;
+    }
+    double ns = benchNowNs() - start;
+    suiteSink += hits;
+    return ns;
+}
+
+// Drain SUITE_SCHEDULED_FLIGHTS queued flights through one policy on 8 runways
+static double suiteSchedulePolicy(SuiteContext* context) {
+    SchedulerConfig config = dayConfig(context->algorithm, 8, 0);
+    config.sharedFlightRecords = 1;    // The records are reused by every repetition
+    Scheduler* scheduler = createSchedulerWithConfig(config);
+    scheduler->verbose = 0;
+    addFlightsToSchedulerBulk(scheduler, context->scheduled, SUITE_SCHEDULED_FLIGHTS);
+    
+    double start = benchNowNs();
+    while (hasWaitingFlights(scheduler)) {
+        switch (context->algorithm) {
+            case FCFS: scheduleFCFS(scheduler); break;
+            case PRIORITY_SCHED: schedulePriority(scheduler); break;
+            case SJF: scheduleSJF(scheduler); break;
+            case ROUND_ROBIN: scheduleRoundRobin(scheduler); break;
+        }
+        scheduler->currentTime += 10;    // Longer than any processing time: every runway frees up
+    }
+    completeDueOperations(scheduler);
+    double ns = benchNowNs() - start;
+    suiteSink += scheduler->totalFlightsProcessed;
+    freeScheduler(scheduler);
+    return ns;
+}
+
+static double suiteFullDay(SuiteContext* context) {
+    (void)context;
+    DayResult day = runBenchDay(2000, 60, dayConfig(PRIORITY_SCHED, DEFAULT_RUNWAY_COUNT, 0), 1);
+    suiteSink += day.processed;
+    return day.ms * 1e6;
+}
+
+// Export of a mid-day state: 2000 flights, 120 minutes in, Priority on 4 runways.
+// Runs in bench_export/ so the dashboard's data/ is left alone.
+static double suiteExport(SuiteContext* context) {
+    (void)context;
+    FlightRegistry* registry = createFlightRegistry();
+    Scheduler* scheduler = createSchedulerWithConfig(dayConfig(PRIORITY_SCHED, 4, 0));
+    scheduler->registry = registry;
+    scheduler->verbose = 0;
+    Flight** flights = makeBenchFlights(registry->flightPool, 2000);
+    addFlightsToSchedulerBulk(scheduler, flights, 2000);
+    setSchedulerTime(scheduler, 0);
+    simulateFor(scheduler, 120, NULL);
+    
+    double start = benchNowNs();
+    exportAllDataJSON(scheduler, registry);
+    double ns = benchNowNs() - start;
+    
+    freeScheduler(scheduler);
+    freeFlightRegistry(registry);
+    free(flights);
+    return ns;
+}
+
+static void writeSuiteJSON(const char* filename) {
+    FILE* file = fopen(filename, "w");
+    if (!file) {
+        printf("Error: Cannot open %s for writing\n", filename);
+        return;
+    }
+    
+    fprintf(file, "{\n");
+    fprintf(file, "  \"repeats\": %d,\n", SUITE_REPEATS);
+    fprintf(file, "  \"results\": [\n");
+    for (int i = 0; i < suiteResultCount; i++) {
+        SuiteResult* result = &suiteResults[i];
+        fprintf(file, "    {\"group\": \"%s\", \"name\": \"%s\", \"operations\": %ld, "
+                      "\"medianNsPerOp\": %.2f, \"bestNsPerOp\": %.2f}%s\n",
+                result->group, result->name, result->operations, result->medianNs, result->bestNs,
+                i + 1 < suiteResultCount ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+    fprintf(file, "  \"timestamp\": %ld\n", (long)time(NULL));
+    fprintf(file, "}\n");
+    fclose(file);
+    printf("\n📤 Suite results written to %s\n", filename);
+}
+
+static void runSuite(const char* jsonFile) {
+    printf("\n=== Tracked suite: median and best of %d runs (ns per operation) ===\n", SUITE_REPEATS);
+    printf("%-5s | %-20s | %9s | %14s | %12s\n", "group", "case", "ops", "median ns/op", "best ns/op");
+    
+    SuiteContext context;
+    memset(&context, 0, sizeof(context));
+    context.pool = createMemoryPool(sizeof(Flight), 1024);
+    context.table = makeBenchTable(context.pool, SUITE_FLIGHTS, 4242);
+    context.list = makeBenchFlights(context.pool, SUITE_LIST_FLIGHTS);
+    for (int i = 0; i + 1 < SUITE_LIST_FLIGHTS; i++) {
+        context.list[i]->next = context.list[i + 1];
+    }
+    context.registry = createFlightRegistry();
+    Flight** registered = makeBenchFlights(context.registry->flightPool, SUITE_FLIGHTS);
+    addFlightsToRegistryBulk(context.registry, registered, SUITE_FLIGHTS);
+    context.ids = (char (*)[16])malloc(sizeof(char[16]) * SUITE_FLIGHTS);
+    unsigned int seed = 2718;
+    for (int i = 0; i < SUITE_FLIGHTS; i++) {
+        int bound = i < SUITE_LIST_FLIGHTS ? SUITE_LIST_FLIGHTS : SUITE_FLIGHTS;
+        sprintf(context.ids[i], "FL%07d", (int)(benchRandom(&seed) % (unsigned int)bound));
+    }
+    context.scheduled = (Flight**)malloc(sizeof(Flight*) * SUITE_SCHEDULED_FLIGHTS);
+    for (int i = 0; i < SUITE_SCHEDULED_FLIGHTS; i++) {
+        context.scheduled[i] = getFlightRecord(context.table, i);
+    }
+    
+    runSuiteCase("micro", "enqueue", SUITE_FLIGHTS, suiteEnqueue, &context);
+    runSuiteCase("micro", "dequeue", SUITE_FLIGHTS, suiteDequeue, &context);
+    runSuiteCase("micro", "insertPriorityQueue", SUITE_FLIGHTS, suiteInsertPriorityQueue, &context);
+    runSuiteCase("micro", "extractMin", SUITE_FLIGHTS, suiteExtractMin, &context);
+    runSuiteCase("micro", "compareFlight", SUITE_FLIGHTS - 1, suiteCompareFlight, &context);
+    runSuiteCase("micro", "findFlight", SUITE_LIST_FLIGHTS, suiteFindFlight, &context);
+    runSuiteCase("micro", "findFlightInRegistry", SUITE_FLIGHTS, suiteFindFlightInRegistry, &context);
+    
+    const char* policies[] = {"scheduleFCFS", "schedulePriority", "scheduleSJF", "scheduleRoundRobin"};
+    for (int a = 0; a < 4; a++) {
+        context.algorithm = (SchedulingAlgorithm)(FCFS + a);
+        runSuiteCase("micro", policies[a], SUITE_SCHEDULED_FLIGHTS, suiteSchedulePolicy, &context);
+    }
+    
+    runSuiteCase("macro", "fullDaySimulation", 1, suiteFullDay, &context);
+    #ifdef _WIN32
+        system("if not exist bench_export mkdir bench_export");
+    #else
+        system("mkdir -p bench_export");
+    #endif
+    if (chdir("bench_export") == 0) {
+        runSuiteCase("macro", "exportAllDataJSON", 1, suiteExport, &context);
+        if (chdir("..") != 0) printf("❌ Cannot leave bench_export!\n");
+    }
+    
+    if (jsonFile != NULL) writeSuiteJSON(jsonFile);
+    
+    free(context.scheduled);
+    free(context.ids);
+    free(registered);
+    freeFlightRegistry(context.registry);
+    free(context.list);
+    freeFlightTable(context.table);
+    destroyMemoryPool(context.pool);
+}
+
+int main(int argc, char* argv[]) {
+    int suiteOnly = 0;
+    const char* jsonFile = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--suite") == 0) {
+            suiteOnly = 1;
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonFile = argv[++i];
+        } else {
+            printf("Usage: %s [--suite] [--json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (suiteOnly) {
+        runSuite(jsonFile);
+        return 0;
+    }
+    
+    printf("\n=== Flight registry (ns per operation) ===\n");
+    printf("%10s | %12s | %12s | %14s | %s\n",
+           "flights", "insert", "hash lookup", "list findFlight", "count");
+    int sizes[] = {1000, 10000, 100000, 1000000};
+    for (int i = 0; i < 4; i++) {
+        benchRegistry(sizes[i]);
+    }
+    
+    printf("\n=== Priority queue fan-out (ns per operation) ===\n");
+    printf("%8s | %5s | %10s | %10s | %14s\n", "depth", "arity", "insert", "extractMin", "extract+insert");
+    MemoryPool* pool = createMemoryPool(sizeof(Flight), 1024);
+    int depths[] = {100, 1000, 10000, 100000};
+    for (int d = 0; d < 4; d++) {
+        FlightTable* table = makeBenchTable(pool, depths[d], 99);
+        benchHeap(table, depths[d], 2);
+        benchHeap(table, depths[d], 4);
+        benchHeap(table, depths[d], 8);
+        freeFlightTable(table);
+        resetMemoryPool(pool);
+    }
+    
+    printf("\n=== Heap ordering: field compares vs packed keys, arity 4 (ns per operation) ===\n");
+    printf("%8s | %13s | %13s | %11s | %11s\n",
+           "depth", "fields insert", "fields extract", "keys insert", "keys extract");
+    for (int d = 0; d < 4; d++) {
+        FlightTable* table = makeBenchTable(pool, depths[d], 99);
+        benchPackedKeys(table, depths[d]);
+        freeFlightTable(table);
+        resetMemoryPool(pool);
+    }
+    
+    printf("\n=== Priority queue backends: heap vs bucket queue (ns per operation) ===\n");
+    printf("%8s | %-6s | %10s | %10s | %14s\n", "depth", "queue", "insert", "extractMin", "extract+insert");
+    int backendDepths[] = {1000, 10000, 100000, 1000000};
+    for (int d = 0; d < 4; d++) {
+        FlightTable* table = makeBenchTable(pool, backendDepths[d], 99);
+        benchQueueBackend(table, backendDepths[d], HEAP_QUEUE);
+        benchQueueBackend(table, backendDepths[d], BUCKET_QUEUE);
+        freeFlightTable(table);
+        resetMemoryPool(pool);
+    }
+    destroyMemoryPool(pool);
+    
+    printf("\n=== Schedule loading: one by one vs bulk (ms for the whole schedule) ===\n");
+    printf("%8s | %-9s | %11s | %8s\n", "flights", "algorithm", "one by one", "bulk");
+    int schedules[] = {10000, 100000};
+    for (int i = 0; i < 2; i++) {
+        printf("%8d | %-9s | %11.2f | %8.2f\n", schedules[i], "FCFS",
+               benchStartup(schedules[i], FCFS, 0), benchStartup(schedules[i], FCFS, 1));
+        printf("%8d | %-9s | %11.2f | %8.2f\n", schedules[i], "Priority",
+               benchStartup(schedules[i], PRIORITY_SCHED, 0), benchStartup(schedules[i], PRIORITY_SCHED, 1));
+    }
+    
+    printf("\n=== 24-hour day: tick mode vs event-driven (steps, ms) ===\n");
+    printf("%9s | %-9s | %6s | %8s | %6s | %8s | %9s | %s\n",
+           "movements", "algorithm", "ticks", "tick ms", "events", "event ms", "processed", "result");
+    int days[] = {300, 5000};
+    for (int i = 0; i < 2; i++) {
+        benchDay(days[i], FCFS, "FCFS");
+        benchDay(days[i], PRIORITY_SCHED, "Priority");
+        benchDay(days[i], SJF, "SJF");
+        benchDay(days[i], ROUND_ROBIN, "RR");
+    }
+    
+    printf("\n=== 24-hour day by runway count (Priority, event-driven) ===\n");
+    printf("%7s | %9s | %8s | %9s | %8s\n", "runways", "movements", "event ms", "processed", "avg wait");
+    int runwayCounts[] = {1, 2, 6, 16, 64};
+    for (int i = 0; i < 5; i++) {
+        DayResult day = runBenchDay(5000, 0, dayConfig(PRIORITY_SCHED, runwayCounts[i], 0), 1);
+        printf("%7d | %9d | %8.3f | %9d | %8.2f\n", runwayCounts[i], 5000, day.ms, day.processed,
+               day.processed > 0 ? (double)day.waiting / day.processed : 0.0);
+    }
+    
+    // About 450 movements per runway per day keeps every runway ~80% busy
+    printf("\n=== Dispatch per pass: one flight vs every free runway (completed, avg wait) ===\n");
+    printf("%7s | %-9s | %9s | %9s | %9s | %9s | %s\n",
+           "runways", "algorithm", "1 done", "1 wait", "fill done", "fill wait", "throughput");
+    int dispatchRunways[] = {2, 6};
+    for (int i = 0; i < 2; i++) {
+        int movements = 450 * dispatchRunways[i];
+        benchDispatch(movements, dispatchRunways[i], FCFS, "FCFS");
+        benchDispatch(movements, dispatchRunways[i], PRIORITY_SCHED, "Priority");
+        benchDispatch(movements, dispatchRunways[i], SJF, "SJF");
+        benchDispatch(movements, dispatchRunways[i], ROUND_ROBIN, "RR");
+    }
+    
+    printf("\n=== SJF dispatch: queue scan vs shortest-job heap (ns per dispatch) ===\n");
+    printf("%8s | %12s | %12s | %s\n", "backlog", "queue scan", "heap", "speedup");
+    int backlogs[] = {1000, 10000, 100000};
+    for (int i = 0; i < 3; i++) {
+        benchShortestJob(backlogs[i]);
+    }
+    
+    printf("\n=== SJF aging on a saturated day (2 runways) ===\n");
+    printf("%6s | %9s | %9s | %8s | %s\n", "aging", "movements", "processed", "avg wait", "oldest waiting");
+    int agingRates[] = {0, 1, 4, 16};
+    for (int i = 0; i < 4; i++) {
+        benchSjfAging(1300, agingRates[i]);
+    }
+    
+    printf("\n=== Emergency response: 1000 movements + 60 emergencies, 2 runways (latency in min) ===\n");
+    printf("%-9s | %-7s | %6s | %8s | %5s | %9s | %8s | %s\n",
+           "algorithm", "preempt", "served", "avg lat", "worst", "preempted", "avg wait", "tick vs event");
+    for (int preemption = 0; preemption <= 1; preemption++) {
+        benchEmergencyResponse(1000, 60, FCFS, "FCFS", preemption);
+        benchEmergencyResponse(1000, 60, PRIORITY_SCHED, "Priority", preemption);
+        benchEmergencyResponse(1000, 60, SJF, "SJF", preemption);
+        benchEmergencyResponse(1000, 60, ROUND_ROBIN, "RR", preemption);
+    }
+    
+    printf("\n=== Concurrent schedulers: same day on every thread, all 4 algorithms (1000 movements + 60 emergencies) ===\n");
+    printf("%7s | %9s | %11s | %13s | %s\n", "threads", "schedulers", "1 thread ms", "concurrent ms", "vs reference");
+    int threadCounts[] = {2, 4, 8};
+    for (int i = 0; i < 3; i++) {
+        benchConcurrentSchedulers(threadCounts[i], 1000, 60);
+    }
+    
+    printf("\n=== Multi-airport day: 16 airports (4 hubs at 8x traffic), hourly windows ===\n");
+    printf("%7s | %8s | %9s | %9s | %8s | %12s | %6s | %s\n",
+           "threads", "airports", "scheduled", "processed", "wall ms", "movements/s", "stolen", "vs 1 thread");
+    int runnerThreads[] = {1, 2, 4, 8};
+    int firstMovements = -1;
+    for (int i = 0; i < 4; i++) {
+        benchMultiAirport(16, 400, runnerThreads[i], &firstMovements);
+    }
+    
+    printf("\n=== Airport network: 8 airports x 500 departures, 45 min flights (landings handed over) ===\n");
+    printf("%7s | %6s | %7s | %9s | %9s | %8s | %12s | %s\n",
+           "threads", "window", "windows", "processed", "handed on", "wall ms", "movements/s", "vs first run");
+    long firstWaiting = -1;
+    benchAirportNetwork(8, 500, 45, 4, 1, &firstWaiting);
+    for (int i = 0; i < 4; i++) {
+        benchAirportNetwork(8, 500, 45, runnerThreads[i], 0, &firstWaiting);
+    }
+    
+    printf("\n=== Algorithm comparison: 4 algorithms on one shared workload, 1 thread vs 4 ===\n");
+    printf("%9s | %11s | %9s | %11s | %14s | %s\n",
+           "movements", "emergencies", "serial ms", "parallel ms", "KB not copied", "reports");
+    benchCompareRunner(1000, 60, 0);
+    benchCompareRunner(20000, 200, 0);
+    benchCompareRunner(1000, 60, 1);
+    
+    printf("\n=== Generated workloads: seed 2024, Priority day on %d runways (event heap vs bulk feed) ===\n", MAX_RUNWAYS);
+    printf("%8s | %11s | %8s | %9s | %-9s | %9s | %9s | %9s | %s\n",
+           "flights", "emergencies", "gen ms", "ns/flight", "same seed", "events ms", "feed ms", "processed", "results");
+    int generated[] = {10000, 100000, 1000000};
+    for (int i = 0; i < 3; i++) {
+        benchGeneratedWorkload(generated[i]);
+    }
+    
+    printf("\n=== FIFO queue: ring buffer vs linked nodes (ns per flight) ===\n");
+    printf("%8s | %-6s | %8s | %8s | %8s | %8s\n", "queued", "queue", "enqueue", "dequeue", "hold", "scan");
+    int queued[] = {1000, 100000, 1000000};
+    for (int i = 0; i < 3; i++) {
+        benchQueue(queued[i]);
+    }
+    
+    printf("\n=== Completion stats: streaming aggregates (wait percentiles exact / sketch, min) ===\n");
+    printf("%9s | %9s | %13s | %13s | %13s\n", "completed", "ns/record", "p50", "p95", "p99");
+    int completions[] = {10000, 1000000};
+    for (int i = 0; i < 2; i++) {
+        benchCompletionStats(completions[i]);
+    }
+    
+    printf("\n=== Completion log: completed-flights list vs record ring (ns per completion) ===\n");
+    printf("%9s | %11s | %8s | %10s | %s\n", "completed", "linked list", "ring", "ring+spill", "replayed from spill");
+    int logged[] = {1000, 20000, 1000000};
+    for (int i = 0; i < 3; i++) {
+        benchCompletionLog(logged[i]);
+    }
+    
+    printf("\n=== Phase probes: hot-path latency histograms ===\n");
+    benchPhaseProbes(20000);
+    
+    runSuite(jsonFile);
+    return 0;
+}
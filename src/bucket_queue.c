@@ -0,0 +1,336 @@
+#include "bucket_queue.h"
+#include "queue.h"
+
+// Index of the lowest set bit (word must be non-zero)
+static int lowestBit(unsigned long long word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while ((word & 1ULL) == 0) {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Create an empty bucket queue ordering flights of the given table
+BucketQueue* createBucketQueue(FlightTable* table) {
+    BucketQueue* bq = (BucketQueue*)calloc(1, sizeof(BucketQueue));
+    if (bq == NULL) {
+        printf("❌ Memory allocation failed for bucket queue!\n");
+        return NULL;
+    }
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        bq->head[i] = NO_FLIGHT;
+        bq->tail[i] = NO_FLIGHT;
+    }
+    bq->firstWord = BUCKET_WORDS;
+    bq->baseMinute = 0;
+    bq->table = table;
+    return bq;
+}
+
+static int clampedEmergency(FlightTable* table, FlightIndex flight) {
+    int emergency = table->emergencyType[flight];
+    if (emergency < 0) emergency = 0;
+    if (emergency >= BUCKET_EMERGENCY_LEVELS) emergency = BUCKET_EMERGENCY_LEVELS - 1;
+    return emergency;
+}
+
+static int clampedPriority(FlightTable* table, FlightIndex flight) {
+    int priority = table->priority[flight];
+    if (priority < 1) priority = 1;
+    if (priority > BUCKET_PRIORITY_LEVELS) priority = BUCKET_PRIORITY_LEVELS;
+    return priority;
+}
+
+// Bucket of a flight: lower buckets are served first (same order as the heap
+// keys). -1 if its scheduled minute is outside the window.
+int flightBucket(BucketQueue* bq, FlightIndex flight) {
+    int minute = bq->table->scheduledTime[flight] - bq->baseMinute;
+    if (minute < 0 || minute >= BUCKET_MINUTES) return -1;
+    
+    int level = (BUCKET_EMERGENCY_LEVELS - 1 - clampedEmergency(bq->table, flight)) * BUCKET_PRIORITY_LEVELS +
+                (BUCKET_PRIORITY_LEVELS - clampedPriority(bq->table, flight));
+    return level * BUCKET_MINUTES + minute;
+}
+
+// Heap key of a queued flight, to compare bucketed and overflow flights
+static PriorityKey bucketFlightKey(BucketQueue* bq, FlightIndex flight) {
+    return makePriorityKey(clampedEmergency(bq->table, flight), clampedPriority(bq->table, flight),
+                           bq->table->scheduledTime[flight], bq->sequence[flight]);
+}
+
+// Grow the per-flight link arrays so they cover flight
+static int ensureBucketLinks(BucketQueue* bq, FlightIndex flight) {
+    if (flight < bq->linkCapacity) return 1;
+    
+    int newCapacity = bq->linkCapacity > 0 ? bq->linkCapacity : 64;
+    while (newCapacity <= flight) newCapacity *= 2;
+    
+    int* next = (int*)realloc(bq->next, sizeof(int) * newCapacity);
+    if (next) bq->next = next;
+    int* prev = (int*)realloc(bq->prev, sizeof(int) * newCapacity);
+    if (prev) bq->prev = prev;
+    int* bucketOf = (int*)realloc(bq->bucketOf, sizeof(int) * newCapacity);
+    if (bucketOf) bq->bucketOf = bucketOf;
+    int* memberSlot = (int*)realloc(bq->memberSlot, sizeof(int) * newCapacity);
+    if (memberSlot) bq->memberSlot = memberSlot;
+    unsigned int* sequence = (unsigned int*)realloc(bq->sequence, sizeof(unsigned int) * newCapacity);
+    if (sequence) bq->sequence = sequence;
+    int* overflowSlot = (int*)realloc(bq->overflowSlot, sizeof(int) * newCapacity);
+    if (overflowSlot) bq->overflowSlot = overflowSlot;
+    
+    if (!next || !prev || !bucketOf || !memberSlot || !sequence || !overflowSlot) {
+        printf("❌ Memory allocation failed for bucket queue!\n");
+        return 0;
+    }
+    for (int i = bq->linkCapacity; i < newCapacity; i++) {
+        bq->bucketOf[i] = -1;
+    }
+    bq->linkCapacity = newCapacity;
+    return 1;
+}
+
+// Check whether a flight is queued (O(1))
+int bucketQueueContains(BucketQueue* bq, FlightIndex flight) {
+    if (bq == NULL || flight < 0 || flight >= bq->linkCapacity) return 0;
+    return bq->bucketOf[flight] >= 0;
+}
+
+// ==================== OVERFLOW HEAP ====================
+
+static void placeOverflow(BucketQueue* bq, int slot, PriorityKey key, FlightIndex flight) {
+    bq->overflowKeys[slot] = key;
+    bq->overflow[slot] = flight;
+    bq->overflowSlot[flight] = slot;
+}
+
+static void siftOverflowUp(BucketQueue* bq, int slot) {
+    PriorityKey key = bq->overflowKeys[slot];
+    FlightIndex flight = bq->overflow[slot];
+    while (slot > 0) {
+        int parent = (slot - 1) / 2;
+        if (bq->overflowKeys[parent] <= key) break;
+        placeOverflow(bq, slot, bq->overflowKeys[parent], bq->overflow[parent]);
+        slot = parent;
+    }
+    placeOverflow(bq, slot, key, flight);
+}
+
+static void siftOverflowDown(BucketQueue* bq, int slot) {
+    PriorityKey key = bq->overflowKeys[slot];
+    FlightIndex flight = bq->overflow[slot];
+    for (;;) {
+        int child = 2 * slot + 1;
+        if (child >= bq->overflowSize) break;
+        if (child + 1 < bq->overflowSize && bq->overflowKeys[child + 1] < bq->overflowKeys[child]) child++;
+        if (bq->overflowKeys[child] >= key) break;
+        placeOverflow(bq, slot, bq->overflowKeys[child], bq->overflow[child]);
+        slot = child;
+    }
+    placeOverflow(bq, slot, key, flight);
+}
+
+// Queue a flight outside the window (O(log overflow))
+static int pushOverflow(BucketQueue* bq, FlightIndex flight) {
+    if (bq->overflowSize == bq->overflowCapacity) {
+        int newCapacity = bq->overflowCapacity > 0 ? bq->overflowCapacity * 2 : 16;
+        PriorityKey* keys = (PriorityKey*)realloc(bq->overflowKeys, sizeof(PriorityKey) * newCapacity);
+        if (keys) bq->overflowKeys = keys;
+        FlightIndex* flights = (FlightIndex*)realloc(bq->overflow, sizeof(FlightIndex) * newCapacity);
+        if (flights) bq->overflow = flights;
+        if (!keys || !flights) {
+            printf("❌ Memory allocation failed for bucket queue!\n");
+            return 0;
+        }
+        bq->overflowCapacity = newCapacity;
+    }
+    bq->bucketOf[flight] = BUCKET_OVERFLOW;
+    placeOverflow(bq, bq->overflowSize++, bucketFlightKey(bq, flight), flight);
+    siftOverflowUp(bq, bq->overflowSize - 1);
+    return 1;
+}
+
+static void removeOverflow(BucketQueue* bq, FlightIndex flight) {
+    int slot = bq->overflowSlot[flight];
+    bq->overflowSize--;
+    if (slot < bq->overflowSize) {
+        FlightIndex moved = bq->overflow[bq->overflowSize];
+        placeOverflow(bq, slot, bq->overflowKeys[bq->overflowSize], moved);
+        siftOverflowUp(bq, slot);
+        siftOverflowDown(bq, bq->overflowSlot[moved]);
+    }
+}
+
+// ==================== BUCKETS ====================
+
+// Put a flight into its bucket, after every flight of the bucket inserted
+// before it (O(1) for a new flight, which always goes to the tail), or into
+// the overflow heap. The window moves to the flight's day while no flight is
+// bucketed.
+static int attachFlight(BucketQueue* bq, FlightIndex flight) {
+    int bucket = flightBucket(bq, flight);
+    if (bucket < 0 && bq->bucketed == 0) {
+        int minute = bq->table->scheduledTime[flight];
+        int day = minute >= 0 ? minute / BUCKET_MINUTES : -((-minute + BUCKET_MINUTES - 1) / BUCKET_MINUTES);
+        bq->baseMinute = day * BUCKET_MINUTES;
+        bq->firstWord = BUCKET_WORDS;
+        bucket = flightBucket(bq, flight);
+    }
+    if (bucket < 0) return pushOverflow(bq, flight);
+    
+    int after = bq->tail[bucket];
+    while (after != NO_FLIGHT && bq->sequence[after] > bq->sequence[flight]) {
+        after = bq->prev[after];
+    }
+    int before = after != NO_FLIGHT ? bq->next[after] : bq->head[bucket];
+    
+    bq->bucketOf[flight] = bucket;
+    bq->prev[flight] = after;
+    bq->next[flight] = before;
+    if (after != NO_FLIGHT) {
+        bq->next[after] = flight;
+    } else {
+        bq->head[bucket] = flight;
+        bq->occupied[bucket >> 6] |= 1ULL << (bucket & 63);
+        if ((bucket >> 6) < bq->firstWord) bq->firstWord = bucket >> 6;
+    }
+    if (before != NO_FLIGHT) {
+        bq->prev[before] = flight;
+    } else {
+        bq->tail[bucket] = flight;
+    }
+    bq->bucketed++;
+    return 1;
+}
+
+// Take a queued flight out of its bucket or the overflow heap
+static void detachFlight(BucketQueue* bq, FlightIndex flight) {
+    int bucket = bq->bucketOf[flight];
+    bq->bucketOf[flight] = -1;
+    if (bucket == BUCKET_OVERFLOW) {
+        removeOverflow(bq, flight);
+        return;
+    }
+    
+    if (bq->prev[flight] != NO_FLIGHT) {
+        bq->next[bq->prev[flight]] = bq->next[flight];
+    } else {
+        bq->head[bucket] = bq->next[flight];
+    }
+    if (bq->next[flight] != NO_FLIGHT) {
+        bq->prev[bq->next[flight]] = bq->prev[flight];
+    } else {
+        bq->tail[bucket] = bq->prev[flight];
+    }
+    if (bq->head[bucket] == NO_FLIGHT) {
+        bq->occupied[bucket >> 6] &= ~(1ULL << (bucket & 63));
+    }
+    bq->bucketed--;
+}
+
+// Add a flight behind every equal flight already queued (O(1) in the window)
+void bucketQueueInsert(BucketQueue* bq, FlightIndex flight) {
+    if (bq == NULL || flight == NO_FLIGHT || !ensureBucketLinks(bq, flight)) return;
+    if (bq->bucketOf[flight] >= 0) return;    // Already queued
+    
+    if (bq->size == bq->memberCapacity) {
+        int newCapacity = bq->memberCapacity > 0 ? bq->memberCapacity * 2 : 64;
+        FlightIndex* members = (FlightIndex*)realloc(bq->members, sizeof(FlightIndex) * newCapacity);
+        if (members == NULL) {
+            printf("❌ Memory allocation failed for bucket queue!\n");
+            return;
+        }
+        bq->members = members;
+        bq->memberCapacity = newCapacity;
+    }
+    
+    bq->sequence[flight] = bq->nextSequence++;
+    if (!attachFlight(bq, flight)) return;
+    
+    bq->memberSlot[flight] = bq->size;
+    bq->members[bq->size++] = flight;
+}
+
+// Best flight without removing it (amortized O(1))
+FlightIndex bucketQueuePeekMin(BucketQueue* bq) {
+    if (bq == NULL || bq->size == 0) return NO_FLIGHT;
+    
+    FlightIndex best = NO_FLIGHT;
+    if (bq->bucketed > 0) {
+        // The cursor only moves forward between inserts of better flights
+        while (bq->occupied[bq->firstWord] == 0) {
+            bq->firstWord++;
+        }
+        int bucket = (bq->firstWord << 6) + lowestBit(bq->occupied[bq->firstWord]);
+        best = bq->head[bucket];
+    }
+    if (bq->overflowSize > 0 && (best == NO_FLIGHT || bq->overflowKeys[0] < bucketFlightKey(bq, best))) {
+        best = bq->overflow[0];
+    }
+    return best;
+}
+
+// Unlink a queued flight from its bucket and the member list
+static void unlinkBucketFlight(BucketQueue* bq, FlightIndex flight) {
+    detachFlight(bq, flight);
+    
+    // Swap-remove from the dense member list
+    int slot = bq->memberSlot[flight];
+    FlightIndex last = bq->members[--bq->size];
+    bq->members[slot] = last;
+    bq->memberSlot[last] = slot;
+}
+
+// Remove and return the best flight (amortized O(1))
+FlightIndex bucketQueueExtractMin(BucketQueue* bq) {
+    FlightIndex flight = bucketQueuePeekMin(bq);
+    if (flight != NO_FLIGHT) {
+        unlinkBucketFlight(bq, flight);
+    }
+    return flight;
+}
+
+// Remove a flight from anywhere in the queue (O(1) in the window)
+int bucketQueueRemove(BucketQueue* bq, FlightIndex flight) {
+    if (!bucketQueueContains(bq, flight)) return 0;
+    unlinkBucketFlight(bq, flight);
+    return 1;
+}
+
+// Move a flight whose priority fields changed to its new place. It keeps its
+// insertion sequence, so it still leaves before equal flights queued after
+// it (O(bucket length) at worst, O(log overflow) outside the window).
+void bucketQueueUpdate(BucketQueue* bq, FlightIndex flight) {
+    if (!bucketQueueContains(bq, flight)) return;
+    int bucket = flightBucket(bq, flight);
+    if (bucket >= 0 && bq->bucketOf[flight] == bucket) return;
+    
+    detachFlight(bq, flight);
+    if (!attachFlight(bq, flight)) {
+        // Out of memory for the overflow heap: drop it like a removal
+        int slot = bq->memberSlot[flight];
+        FlightIndex last = bq->members[--bq->size];
+        bq->members[slot] = last;
+        bq->memberSlot[last] = slot;
+    }
+}
+
+// Free the bucket queue
+void freeBucketQueue(BucketQueue* bq) {
+    if (bq == NULL) return;
+    
+    free(bq->next);
+    free(bq->prev);
+    free(bq->bucketOf);
+    free(bq->memberSlot);
+    free(bq->sequence);
+    free(bq->overflowSlot);
+    free(bq->members);
+    free(bq->overflowKeys);
+    free(bq->overflow);
+    free(bq);
+}
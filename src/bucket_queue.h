@@ -0,0 +1,60 @@
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+#include "flight_table.h"
+
+// Bucket (radix) priority queue for the small key domain of a flight:
+// 5 emergency types x 3 priorities x a window of 1440 scheduled minutes.
+// Each bucket is a list threaded through per-flight link arrays, kept in
+// insertion order, and an occupancy bitmap (one bit per bucket) finds the
+// best non-empty bucket with find-first-set. Insert is O(1) and extract-min
+// is amortized O(1). The window covers one scheduled day starting at
+// baseMinute and moves to a flight's day when the buckets are empty; flights
+// outside it wait in a small overflow heap on the same keys as the priority
+// heap, so flights leave in exactly the heap's order (ties by insertion).
+#define BUCKET_EMERGENCY_LEVELS 5
+#define BUCKET_PRIORITY_LEVELS 3
+#define BUCKET_MINUTES 1440
+#define BUCKET_COUNT (BUCKET_EMERGENCY_LEVELS * BUCKET_PRIORITY_LEVELS * BUCKET_MINUTES)
+#define BUCKET_WORDS ((BUCKET_COUNT + 63) / 64)
+#define BUCKET_OVERFLOW BUCKET_COUNT     // bucketOf of a flight in the overflow heap
+
+typedef struct BucketQueue {
+    int head[BUCKET_COUNT];          // First flight per bucket (NO_FLIGHT if empty)
+    int tail[BUCKET_COUNT];
+    unsigned long long occupied[BUCKET_WORDS];
+    int firstWord;                   // No occupied bucket below this word
+    int baseMinute;                  // Scheduled minute of the window's first column
+    int bucketed;                    // Flights in buckets (the rest overflow)
+    unsigned int nextSequence;       // Insertion counter for stable ties
+    // Per-flight links, indexed by FlightIndex
+    int* next;
+    int* prev;
+    int* bucketOf;                   // -1 if the flight is not queued
+    int* memberSlot;                 // Slot in members[]
+    unsigned int* sequence;          // Insertion sequence, kept across updates
+    int* overflowSlot;               // Slot in overflow[] while bucketOf is BUCKET_OVERFLOW
+    int linkCapacity;
+    // Dense list of queued flights for iteration (unordered)
+    FlightIndex* members;
+    int size;
+    int memberCapacity;
+    // Binary min-heap of the flights outside the window
+    unsigned long long* overflowKeys;
+    FlightIndex* overflow;
+    int overflowSize;
+    int overflowCapacity;
+    FlightTable* table;
+} BucketQueue;
+
+BucketQueue* createBucketQueue(FlightTable* table);
+int flightBucket(BucketQueue* bq, FlightIndex flight);
+int bucketQueueContains(BucketQueue* bq, FlightIndex flight);
+void bucketQueueInsert(BucketQueue* bq, FlightIndex flight);
+FlightIndex bucketQueuePeekMin(BucketQueue* bq);
+FlightIndex bucketQueueExtractMin(BucketQueue* bq);
+int bucketQueueRemove(BucketQueue* bq, FlightIndex flight);
+void bucketQueueUpdate(BucketQueue* bq, FlightIndex flight);
+void freeBucketQueue(BucketQueue* bq);
+
+#endif
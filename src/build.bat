@@ -20,7 +20,7 @@ if %ERRORLEVEL% NEQ 0 (
     exit /b 1
 )
 
-echo [1/6] Compiling main_integrated.c...
+echo [1/21] Compiling main_integrated.c...
 gcc -Wall -Wextra -g -c main_integrated.c -o main_integrated.o
 if %ERRORLEVEL% NEQ 0 (
     echo ERROR: Failed to compile main_integrated.c
@@ -28,7 +28,47 @@ if %ERRORLEVEL% NEQ 0 (
     exit /b 1
 )
 
-echo [2/6] Compiling flight.c...
+echo [2/21] Compiling profiler.c...
+gcc -Wall -Wextra -g -c profiler.c -o profiler.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile profiler.c
+    pause
+    exit /b 1
+)
+
+echo [3/21] Compiling completion_stats.c...
+gcc -Wall -Wextra -g -c completion_stats.c -o completion_stats.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile completion_stats.c
+    pause
+    exit /b 1
+)
+
+echo [4/21] Compiling completion_log.c...
+gcc -Wall -Wextra -g -c completion_log.c -o completion_log.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile completion_log.c
+    pause
+    exit /b 1
+)
+
+echo [5/21] Compiling pool.c...
+gcc -Wall -Wextra -g -c pool.c -o pool.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile pool.c
+    pause
+    exit /b 1
+)
+
+echo [6/21] Compiling intern.c...
+gcc -Wall -Wextra -g -c intern.c -o intern.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile intern.c
+    pause
+    exit /b 1
+)
+
+echo [7/21] Compiling flight.c...
 gcc -Wall -Wextra -g -c flight.c -o flight.o
 if %ERRORLEVEL% NEQ 0 (
     echo ERROR: Failed to compile flight.c
@@ -36,7 +76,31 @@ if %ERRORLEVEL% NEQ 0 (
     exit /b 1
 )
 
-echo [3/6] Compiling queue.c...
+echo [8/21] Compiling flight_table.c...
+gcc -Wall -Wextra -g -c flight_table.c -o flight_table.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile flight_table.c
+    pause
+    exit /b 1
+)
+
+echo [9/21] Compiling registry.c...
+gcc -Wall -Wextra -g -c registry.c -o registry.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile registry.c
+    pause
+    exit /b 1
+)
+
+echo [10/21] Compiling bucket_queue.c...
+gcc -Wall -Wextra -g -c bucket_queue.c -o bucket_queue.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile bucket_queue.c
+    pause
+    exit /b 1
+)
+
+echo [11/21] Compiling queue.c...
 gcc -Wall -Wextra -g -c queue.c -o queue.o
 if %ERRORLEVEL% NEQ 0 (
     echo ERROR: Failed to compile queue.c
@@ -44,7 +108,7 @@ if %ERRORLEVEL% NEQ 0 (
     exit /b 1
 )
 
-echo [4/6] Compiling scheduler.c...
+echo [12/21] Compiling scheduler.c...
 gcc -Wall -Wextra -g -c scheduler.c -o scheduler.o
 if %ERRORLEVEL% NEQ 0 (
     echo ERROR: Failed to compile scheduler.c
@@ -52,7 +116,63 @@ if %ERRORLEVEL% NEQ 0 (
     exit /b 1
 )
 
-echo [5/6] Compiling api_bridge.c...
+echo [13/21] Compiling virtual_clock.c...
+gcc -Wall -Wextra -g -c virtual_clock.c -o virtual_clock.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile virtual_clock.c
+    pause
+    exit /b 1
+)
+
+echo [14/21] Compiling simulation.c...
+gcc -Wall -Wextra -g -c simulation.c -o simulation.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile simulation.c
+    pause
+    exit /b 1
+)
+
+echo [15/21] Compiling worker_pool.c...
+gcc -Wall -Wextra -g -c worker_pool.c -o worker_pool.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile worker_pool.c
+    pause
+    exit /b 1
+)
+
+echo [16/21] Compiling multi_airport.c...
+gcc -Wall -Wextra -g -c multi_airport.c -o multi_airport.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile multi_airport.c
+    pause
+    exit /b 1
+)
+
+echo [17/21] Compiling workload.c...
+gcc -Wall -Wextra -g -c workload.c -o workload.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile workload.c
+    pause
+    exit /b 1
+)
+
+echo [18/21] Compiling algorithm_compare.c...
+gcc -Wall -Wextra -g -c algorithm_compare.c -o algorithm_compare.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile algorithm_compare.c
+    pause
+    exit /b 1
+)
+
+echo [19/21] Compiling workload_generator.c...
+gcc -Wall -Wextra -g -c workload_generator.c -o workload_generator.o
+if %ERRORLEVEL% NEQ 0 (
+    echo ERROR: Failed to compile workload_generator.c
+    pause
+    exit /b 1
+)
+
+echo [20/21] Compiling api_bridge.c...
 gcc -Wall -Wextra -g -c api_bridge.c -o api_bridge.o
 if %ERRORLEVEL% NEQ 0 (
     echo ERROR: Failed to compile api_bridge.c
@@ -60,8 +180,8 @@ if %ERRORLEVEL% NEQ 0 (
     exit /b 1
 )
 
-echo [6/6] Linking...
-gcc -Wall -Wextra -g -o airport_system.exe main_integrated.o flight.o queue.o scheduler.o api_bridge.o
+echo [21/21] Linking...
+gcc -Wall -Wextra -g -o airport_system.exe main_integrated.o profiler.o completion_stats.o completion_log.o pool.o intern.o flight.o flight_table.o registry.o bucket_queue.o queue.o scheduler.o virtual_clock.o simulation.o worker_pool.o multi_airport.o workload.o algorithm_compare.o workload_generator.o api_bridge.o
 if %ERRORLEVEL% NEQ 0 (
     echo ERROR: Failed to link
     pause
@@ -0,0 +1,147 @@
+#include "completion_log.h"
+
+#define SPILL_BUFFER_BYTES (64 * 1024)
+
+CompletionLog* createCompletionLog(int capacity) {
+    CompletionLog* log = (CompletionLog*)calloc(1, sizeof(CompletionLog));
+    if (log == NULL) {
+        printf("❌ Memory allocation failed for completion log!\n");
+        return NULL;
+    }
+    log->capacity = capacity > 0 ? capacity : COMPLETION_LOG_DEFAULT_CAPACITY;
+    log->ring = (CompletedOperation*)malloc(sizeof(CompletedOperation) * log->capacity);
+    if (log->ring == NULL) {
+        printf("❌ Memory allocation failed for completion log!\n");
+        free(log);
+        return NULL;
+    }
+    return log;
+}
+
+// Stop spilling after a failed write rather than leave a file with gaps
+static void spillRecord(CompletionLog* log, const CompletedOperation* record) {
+    if (fprintf(log->spill, "%s\t%s\t%d\t%d\t%d\t%u\t%u\t%u\t%u\n",
+                record->flightID, symbolToString(record->airline), record->scheduledTime,
+                record->startedAt, record->completedAt, record->runwayIndex, record->operation,
+                record->priority, record->emergencyType) < 0) {
+        printf("❌ Error writing completion log %s, spilling stopped!\n", log->spillPath);
+        fclose(log->spill);
+        log->spill = NULL;
+        return;
+    }
+    log->spilled++;
+}
+
+// Append every record to path from now on (the file starts afresh with the
+// records still in the ring). Returns 0 if the file cannot be opened.
+int openCompletionSpill(CompletionLog* log, const char* path) {
+    if (log == NULL || path == NULL) return 0;
+    if (log->spill != NULL) {
+        fclose(log->spill);
+        log->spill = NULL;
+    }
+
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        printf("❌ Error opening completion log %s for writing!\n", path);
+        return 0;
+    }
+    setvbuf(file, NULL, _IOFBF, SPILL_BUFFER_BYTES);    // Fewer, larger writes
+    log->spill = file;
+    snprintf(log->spillPath, sizeof(log->spillPath), "%s", path);
+    log->spilled = 0;
+    if (fprintf(file, "%s\n", COMPLETION_LOG_HEADER) < 0) {
+        printf("❌ Error writing completion log %s!\n", path);
+        fclose(file);
+        log->spill = NULL;
+        return 0;
+    }
+
+    int size = completionLogSize(log);
+    for (int age = size - 1; age >= 0 && log->spill != NULL; age--) {
+        spillRecord(log, recentCompletion(log, age));
+    }
+    return log->spill != NULL;
+}
+
+void appendCompletion(CompletionLog* log, const CompletedOperation* record) {
+    if (log == NULL || record == NULL) return;
+    log->ring[log->next] = *record;
+    log->next = log->next + 1 < log->capacity ? log->next + 1 : 0;
+    log->total++;
+    if (log->spill != NULL) spillRecord(log, record);
+}
+
+// Records held in the ring
+int completionLogSize(CompletionLog* log) {
+    if (log == NULL) return 0;
+    return log->total < log->capacity ? (int)log->total : log->capacity;
+}
+
+// The record completed age completions ago (0 = the latest); NULL once it has left the ring
+const CompletedOperation* recentCompletion(CompletionLog* log, int age) {
+    if (log == NULL || age < 0 || age >= completionLogSize(log)) return NULL;
+    int slot = log->next - 1 - age;
+    if (slot < 0) slot += log->capacity;
+    return &log->ring[slot];
+}
+
+// One line of the spill file back into a record (0 for the header or a malformed line)
+static int parseSpilledRecord(const char* line, CompletedOperation* record) {
+    char airline[50];
+    unsigned int runwayIndex, operation, priority, emergencyType;
+    memset(record, 0, sizeof(CompletedOperation));
+    if (line[0] == '#') return 0;
+    if (sscanf(line, "%49[^\t]\t%49[^\t]\t%d\t%d\t%d\t%u\t%u\t%u\t%u",
+               record->flightID, airline, &record->scheduledTime, &record->startedAt,
+               &record->completedAt, &runwayIndex, &operation, &priority, &emergencyType) != 9) {
+        return 0;
+    }
+    record->airline = internString(airline);
+    record->runwayIndex = (unsigned char)runwayIndex;
+    record->operation = (unsigned char)operation;
+    record->priority = (unsigned char)priority;
+    record->emergencyType = (unsigned char)emergencyType;
+    return 1;
+}
+
+// Visit the whole history from the spill file, or what the ring still holds.
+// Returns the number of records visited.
+long long visitCompletions(CompletionLog* log, CompletionVisitor visit, void* context) {
+    if (log == NULL || visit == NULL) return 0;
+
+    if (log->spill != NULL) {
+        fflush(log->spill);
+        FILE* file = fopen(log->spillPath, "r");
+        if (file != NULL) {
+            long long sequence = log->total - log->spilled;
+            long long visited = 0;
+            char line[256];
+            while (visited < log->spilled && fgets(line, sizeof(line), file) != NULL) {
+                CompletedOperation record;
+                if (parseSpilledRecord(line, &record)) {
+                    visit(&record, ++sequence, context);
+                    visited++;
+                }
+            }
+            fclose(file);
+            return visited;
+        }
+        printf("❌ Error reading completion log %s, using the last %d records!\n",
+               log->spillPath, completionLogSize(log));
+    }
+
+    int size = completionLogSize(log);
+    long long sequence = log->total - size;
+    for (int age = size - 1; age >= 0; age--) {
+        visit(recentCompletion(log, age), ++sequence, context);
+    }
+    return size;
+}
+
+void freeCompletionLog(CompletionLog* log) {
+    if (log == NULL) return;
+    if (log->spill != NULL) fclose(log->spill);
+    free(log->ring);
+    free(log);
+}
@@ -0,0 +1,52 @@
+#ifndef COMPLETION_LOG_H
+#define COMPLETION_LOG_H
+
+#include "flight.h"
+
+#define COMPLETION_LOG_DEFAULT_CAPACITY 1024
+#define COMPLETION_LOG_HEADER "# completion-log v1"
+
+// Record log of completed operations.
+// Each completion is copied into a small fixed-size record, so the log never
+// touches (or relinks) the Flight records, which may be shared with other
+// schedulers or linked into the registry. The newest records are kept in a
+// ring buffer for the dashboard and reports; with a spill file every record
+// is also appended to it, so the whole history survives the ring wrapping.
+// The spill file is text, readable without this process: a version line
+// (COMPLETION_LOG_HEADER), then one tab-separated line per operation with
+// flight ID, airline name, scheduled/started/completed minutes, runway
+// index, and the operation, priority and emergency type as numbers.
+typedef struct CompletedOperation {
+    char flightID[50];
+    SymbolID airline;
+    int scheduledTime;
+    int startedAt;                 // Runway assigned
+    int completedAt;
+    unsigned char runwayIndex;
+    unsigned char operation;       // Operation
+    unsigned char priority;        // Priority
+    unsigned char emergencyType;   // EmergencyType
+} CompletedOperation;
+
+typedef struct CompletionLog {
+    CompletedOperation* ring;
+    int capacity;
+    int next;                      // Ring slot the next record goes to
+    long long total;               // Records appended since the log was created
+    FILE* spill;                   // Append-only copy of every record (NULL = none)
+    char spillPath[260];
+    long long spilled;             // Records in the spill file
+} CompletionLog;
+
+// Called for each record, oldest first; sequence is 1 for the first completion
+typedef void (*CompletionVisitor)(const CompletedOperation* record, long long sequence, void* context);
+
+CompletionLog* createCompletionLog(int capacity);
+int openCompletionSpill(CompletionLog* log, const char* path);
+void appendCompletion(CompletionLog* log, const CompletedOperation* record);
+int completionLogSize(CompletionLog* log);
+const CompletedOperation* recentCompletion(CompletionLog* log, int age);
+long long visitCompletions(CompletionLog* log, CompletionVisitor visit, void* context);
+void freeCompletionLog(CompletionLog* log);
+
+#endif
@@ -0,0 +1,238 @@
+#include "completion_stats.h"
+
+#define AIRLINES_INITIAL_CAPACITY 8
+
+CompletionStats* createCompletionStats(int runwayCount) {
+    CompletionStats* stats = (CompletionStats*)calloc(1, sizeof(CompletionStats));
+    if (stats == NULL) {
+        printf("❌ Memory allocation failed for completion statistics!\n");
+        return NULL;
+    }
+    stats->runwayCount = runwayCount > 0 ? runwayCount : 0;
+    if (stats->runwayCount > 0) {
+        stats->runways = (DimensionStats*)calloc(stats->runwayCount, sizeof(DimensionStats));
+        if (stats->runways == NULL) {
+            printf("❌ Memory allocation failed for completion statistics!\n");
+            free(stats);
+            return NULL;
+        }
+    }
+    return stats;
+}
+
+static void recordMinutes(MinuteSketch* sketch, int minutes) {
+    if (minutes < 0) minutes = 0;
+    int bucket = latencyBucket((unsigned long long)minutes);
+    if (bucket >= MINUTE_SKETCH_BUCKETS) bucket = MINUTE_SKETCH_BUCKETS - 1;
+    sketch->counts[bucket]++;
+    sketch->total += minutes;
+    if (minutes > sketch->max) sketch->max = minutes;
+}
+
+static void recordDimension(DimensionStats* dimension, int waitTime, int turnaroundTime) {
+    dimension->flights++;
+    recordMinutes(&dimension->wait, waitTime);
+    recordMinutes(&dimension->turnaround, turnaroundTime);
+}
+
+// Aggregate of an airline, added the first time it completes a flight (NULL if out of memory)
+static DimensionStats* airlineStats(CompletionStats* stats, SymbolID airline) {
+    if ((int)airline < stats->airlineSlotCapacity && stats->airlineSlots[airline] > 0) {
+        return &stats->airlines[stats->airlineSlots[airline] - 1];
+    }
+
+    if ((int)airline >= stats->airlineSlotCapacity) {
+        int newCapacity = stats->airlineSlotCapacity > 0 ? stats->airlineSlotCapacity : 64;
+        while (newCapacity <= (int)airline) newCapacity *= 2;
+        int* slots = (int*)realloc(stats->airlineSlots, sizeof(int) * newCapacity);
+        if (slots == NULL) {
+            printf("❌ Memory allocation failed for airline statistics!\n");
+            return NULL;
+        }
+        memset(slots + stats->airlineSlotCapacity, 0, sizeof(int) * (newCapacity - stats->airlineSlotCapacity));
+        stats->airlineSlots = slots;
+        stats->airlineSlotCapacity = newCapacity;
+    }
+
+    if (stats->airlineCount == stats->airlineCapacity) {
+        int newCapacity = stats->airlineCapacity > 0 ? stats->airlineCapacity * 2 : AIRLINES_INITIAL_CAPACITY;
+        DimensionStats* airlines = (DimensionStats*)realloc(stats->airlines, sizeof(DimensionStats) * newCapacity);
+        if (airlines == NULL) {
+            printf("❌ Memory allocation failed for airline statistics!\n");
+            return NULL;
+        }
+        stats->airlines = airlines;
+        SymbolID* symbols = (SymbolID*)realloc(stats->airlineSymbols, sizeof(SymbolID) * newCapacity);
+        if (symbols == NULL) {
+            printf("❌ Memory allocation failed for airline statistics!\n");
+            return NULL;
+        }
+        stats->airlineSymbols = symbols;
+        stats->airlineCapacity = newCapacity;
+    }
+
+    DimensionStats* entry = &stats->airlines[stats->airlineCount];
+    memset(entry, 0, sizeof(DimensionStats));
+    stats->airlineSymbols[stats->airlineCount] = airline;
+    stats->airlineSlots[airline] = ++stats->airlineCount;
+    return entry;
+}
+
+// Fold one completed operation into every aggregate it belongs to
+void recordCompletedOperation(CompletionStats* stats, int runwayIndex, Operation operation, Priority priority,
+                              EmergencyType emergencyType, SymbolID airline, int waitTime, int turnaroundTime) {
+    if (stats == NULL) return;
+
+    recordDimension(&stats->overall, waitTime, turnaroundTime);
+    if (runwayIndex >= 0 && runwayIndex < stats->runwayCount) {
+        recordDimension(&stats->runways[runwayIndex], waitTime, turnaroundTime);
+    }
+    if (operation == LANDING || operation == TAKEOFF) {
+        recordDimension(&stats->operations[operation], waitTime, turnaroundTime);
+    }
+    if (priority >= SCHEDULED && priority <= EMERGENCY) {
+        recordDimension(&stats->priorities[priority - SCHEDULED], waitTime, turnaroundTime);
+    }
+    if (emergencyType >= NO_EMERGENCY && emergencyType <= INFLIGHT_EMERGENCY) {
+        recordDimension(&stats->emergencies[emergencyType], waitTime, turnaroundTime);
+    }
+    DimensionStats* carrier = airlineStats(stats, airline);
+    if (carrier != NULL) recordDimension(carrier, waitTime, turnaroundTime);
+}
+
+// Nearest-rank percentile in minutes (the bucket's upper bound, capped at the maximum)
+int sketchPercentile(const MinuteSketch* sketch, int samples, int percent) {
+    if (sketch == NULL || samples <= 0) return 0;
+    long long rank = ((long long)samples * percent + 99) / 100;
+    long long seen = 0;
+    for (int b = 0; b < MINUTE_SKETCH_BUCKETS; b++) {
+        seen += sketch->counts[b];
+        if (seen >= rank) {
+            unsigned long long bound = latencyBucketUpperBound(b);
+            return bound < (unsigned long long)sketch->max ? (int)bound : sketch->max;
+        }
+    }
+    return sketch->max;
+}
+
+MinuteSummary summarizeSketch(const MinuteSketch* sketch, int samples) {
+    MinuteSummary summary = {0, 0, 0, 0, 0};
+    if (sketch == NULL || samples <= 0) return summary;
+    summary.mean = (double)sketch->total / samples;
+    summary.p50 = sketchPercentile(sketch, samples, 50);
+    summary.p95 = sketchPercentile(sketch, samples, 95);
+    summary.p99 = sketchPercentile(sketch, samples, 99);
+    summary.max = sketch->max;
+    return summary;
+}
+
+// ==================== OUTPUT ====================
+
+static void displayDimension(const char* label, const DimensionStats* dimension) {
+    if (dimension->flights == 0) return;
+    MinuteSummary wait = summarizeSketch(&dimension->wait, dimension->flights);
+    MinuteSummary turnaround = summarizeSketch(&dimension->turnaround, dimension->flights);
+    printf("  %-20s | %7d | %6.2f %4d %4d %4d %5d | %6.2f %4d %4d %4d %5d\n", label, dimension->flights,
+           wait.mean, wait.p50, wait.p95, wait.p99, wait.max,
+           turnaround.mean, turnaround.p50, turnaround.p95, turnaround.p99, turnaround.max);
+}
+
+// Wait and turnaround per operation, priority, emergency type and airline
+// (runways are listed by the scheduler, which knows their names)
+void displayCompletionStats(CompletionStats* stats) {
+    if (stats == NULL || stats->overall.flights == 0) return;
+
+    printf("  %-20s | %7s | %-28s | %-28s\n", "", "flights", "wait (mean p50 p95 p99 max)",
+           "turnaround (mean p50 p95 p99 max)");
+    displayDimension("all", &stats->overall);
+    for (int o = LANDING; o <= TAKEOFF; o++) {
+        displayDimension(operationToString((Operation)o), &stats->operations[o]);
+    }
+    for (int p = 0; p < PRIORITY_LEVELS; p++) {
+        displayDimension(priorityToString((Priority)(SCHEDULED + p)), &stats->priorities[p]);
+    }
+    for (int e = AIRPORT_DELAY; e < EMERGENCY_TYPES; e++) {
+        displayDimension(emergencyTypeToString((EmergencyType)e), &stats->emergencies[e]);
+    }
+    for (int a = 0; a < stats->airlineCount; a++) {
+        displayDimension(symbolToString(stats->airlineSymbols[a]), &stats->airlines[a]);
+    }
+}
+
+static void writeSketchJSON(FILE* file, const MinuteSketch* sketch, int samples) {
+    MinuteSummary summary = summarizeSketch(sketch, samples);
+    fprintf(file, "{\"mean\": %.2f, \"p50\": %d, \"p95\": %d, \"p99\": %d, \"max\": %d}",
+            summary.mean, summary.p50, summary.p95, summary.p99, summary.max);
+}
+
+static void writeDimensionJSON(FILE* file, const char* key, const DimensionStats* dimension) {
+    if (key != NULL) fprintf(file, "\"%s\": ", key);
+    fprintf(file, "{\"flights\": %d, \"wait\": ", dimension->flights);
+    writeSketchJSON(file, &dimension->wait, dimension->flights);
+    fprintf(file, ", \"turnaround\": ");
+    writeSketchJSON(file, &dimension->turnaround, dimension->flights);
+    fprintf(file, "}");
+}
+
+// Members of the stats export (each line ends with a comma; the caller closes the object)
+void writeCompletionStatsJSON(CompletionStats* stats, FILE* file) {
+    if (stats == NULL || file == NULL) return;
+
+    fprintf(file, "  \"waitTime\": ");
+    writeSketchJSON(file, &stats->overall.wait, stats->overall.flights);
+    fprintf(file, ",\n  \"turnaroundTime\": ");
+    writeSketchJSON(file, &stats->overall.turnaround, stats->overall.flights);
+    fprintf(file, ",\n");
+
+    // Same order as runwayHandled
+    fprintf(file, "  \"byRunway\": [\n");
+    for (int r = 0; r < stats->runwayCount; r++) {
+        fprintf(file, "    ");
+        writeDimensionJSON(file, NULL, &stats->runways[r]);
+        fprintf(file, "%s\n", r + 1 < stats->runwayCount ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+
+    fprintf(file, "  \"byOperation\": {\n    ");
+    writeDimensionJSON(file, "landing", &stats->operations[LANDING]);
+    fprintf(file, ",\n    ");
+    writeDimensionJSON(file, "takeoff", &stats->operations[TAKEOFF]);
+    fprintf(file, "\n  },\n");
+
+    static const char* priorityKeys[PRIORITY_LEVELS] = {"scheduled", "vip", "emergency"};
+    fprintf(file, "  \"byPriority\": {\n");
+    for (int p = 0; p < PRIORITY_LEVELS; p++) {
+        fprintf(file, "    ");
+        writeDimensionJSON(file, priorityKeys[p], &stats->priorities[p]);
+        fprintf(file, "%s\n", p + 1 < PRIORITY_LEVELS ? "," : "");
+    }
+    fprintf(file, "  },\n");
+
+    static const char* emergencyKeys[EMERGENCY_TYPES] = {
+        "none", "airportDelay", "pilotUnavailable", "airplaneDefect", "inflightEmergency"
+    };
+    fprintf(file, "  \"byEmergencyType\": {\n");
+    for (int e = 0; e < EMERGENCY_TYPES; e++) {
+        fprintf(file, "    ");
+        writeDimensionJSON(file, emergencyKeys[e], &stats->emergencies[e]);
+        fprintf(file, "%s\n", e + 1 < EMERGENCY_TYPES ? "," : "");
+    }
+    fprintf(file, "  },\n");
+
+    fprintf(file, "  \"byAirline\": {\n");
+    for (int a = 0; a < stats->airlineCount; a++) {
+        fprintf(file, "    ");
+        writeDimensionJSON(file, symbolToString(stats->airlineSymbols[a]), &stats->airlines[a]);
+        fprintf(file, "%s\n", a + 1 < stats->airlineCount ? "," : "");
+    }
+    fprintf(file, "  },\n");
+}
+
+void freeCompletionStats(CompletionStats* stats) {
+    if (stats == NULL) return;
+    free(stats->runways);
+    free(stats->airlines);
+    free(stats->airlineSymbols);
+    free(stats->airlineSlots);
+    free(stats);
+}
@@ -0,0 +1,66 @@
+#ifndef COMPLETION_STATS_H
+#define COMPLETION_STATS_H
+
+#include "flight.h"
+#include "profiler.h"
+
+// Streaming statistics of completed operations.
+// Every completion is folded into running aggregates in O(1): overall, per
+// runway, per operation, per priority, per emergency type and per airline.
+// Each aggregate keeps a count, a sum, a maximum and a quantile sketch of
+// the wait (scheduled time -> runway assigned) and the turnaround
+// (scheduled time -> operation completed). The sketches are log-linear
+// histograms of minutes, bucketed like the profiler's latency histograms:
+// exact up to 7 minutes, then 8 steps per power of two, so a percentile is
+// never more than 12.5% above the true value.
+#define MINUTE_SKETCH_BUCKETS 160    // Up to 2^22 minutes
+#define PRIORITY_LEVELS 3            // SCHEDULED, VIP, EMERGENCY
+#define EMERGENCY_TYPES 5            // NO_EMERGENCY .. INFLIGHT_EMERGENCY
+
+typedef struct MinuteSketch {
+    unsigned int counts[MINUTE_SKETCH_BUCKETS];
+    long long total;
+    int max;
+} MinuteSketch;
+
+typedef struct DimensionStats {
+    int flights;
+    MinuteSketch wait;
+    MinuteSketch turnaround;
+} DimensionStats;
+
+typedef struct CompletionStats {
+    DimensionStats overall;
+    DimensionStats* runways;              // runwayCount entries
+    int runwayCount;
+    DimensionStats operations[2];         // LANDING, TAKEOFF
+    DimensionStats priorities[PRIORITY_LEVELS];
+    DimensionStats emergencies[EMERGENCY_TYPES];
+    // Airlines in order of first completion; airlineSlots maps a SymbolID
+    // to its entry + 1 (0 = not seen yet)
+    DimensionStats* airlines;
+    SymbolID* airlineSymbols;
+    int airlineCount;
+    int airlineCapacity;
+    int* airlineSlots;
+    int airlineSlotCapacity;
+} CompletionStats;
+
+typedef struct MinuteSummary {
+    double mean;
+    int p50;
+    int p95;
+    int p99;
+    int max;
+} MinuteSummary;
+
+CompletionStats* createCompletionStats(int runwayCount);
+void recordCompletedOperation(CompletionStats* stats, int runwayIndex, Operation operation, Priority priority,
+                              EmergencyType emergencyType, SymbolID airline, int waitTime, int turnaroundTime);
+int sketchPercentile(const MinuteSketch* sketch, int samples, int percent);
+MinuteSummary summarizeSketch(const MinuteSketch* sketch, int samples);
+void displayCompletionStats(CompletionStats* stats);
+void writeCompletionStatsJSON(CompletionStats* stats, FILE* file);
+void freeCompletionStats(CompletionStats* stats);
+
+#endif
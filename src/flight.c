@@ -1,26 +1,15 @@
 #include "flight.h"
 
-// Create a new flight
-Flight* createFlight(const char* id, const char* airline, const char* src, 
-                     const char* dest, int time, Priority pri, Operation op, int procTime) {
-    Flight* newFlight = (Flight*)malloc(sizeof(Flight));
-    if (!newFlight) {
-        printf("❌ Memory allocation failed!\n");
-        return NULL;
-    }
-    
+// Fill in a freshly allocated flight
+static void initFlight(Flight* newFlight, const char* id, const char* airline, const char* src, 
+                       const char* dest, int time, Priority pri, Operation op, int procTime) {
     // Copy strings safely
     strncpy(newFlight->flightID, id, 49);
     newFlight->flightID[49] = '\0';
     
-    strncpy(newFlight->airline, airline, 49);
-    newFlight->airline[49] = '\0';
-    
-    strncpy(newFlight->source, src, 49);
-    newFlight->source[49] = '\0';
-    
-    strncpy(newFlight->destination, dest, 49);
-    newFlight->destination[49] = '\0';
+    newFlight->airline = internString(airline);
+    newFlight->source = internString(src);
+    newFlight->destination = internString(dest);
     
     newFlight->scheduledTime = time;
     newFlight->priority = pri;
@@ -29,8 +18,34 @@ Flight* createFlight(const char* id, const char* airline, const char* src,
     newFlight->processingTime = procTime;
     newFlight->emergencyType = NO_EMERGENCY;
     strcpy(newFlight->emergencyDetails, "None");
+    newFlight->tableIndex = -1;
     newFlight->next = NULL;
+    newFlight->prev = NULL;
+}
+
+// Create a new flight
+Flight* createFlight(const char* id, const char* airline, const char* src, 
+                     const char* dest, int time, Priority pri, Operation op, int procTime) {
+    Flight* newFlight = (Flight*)malloc(sizeof(Flight));
+    if (!newFlight) {
+        printf("❌ Memory allocation failed!\n");
+        return NULL;
+    }
+    
+    initFlight(newFlight, id, airline, src, dest, time, pri, op, procTime);
+    return newFlight;
+}
+
+// Create a new flight in a slab pool (release with poolFree or the pool itself)
+Flight* createPooledFlight(MemoryPool* pool, const char* id, const char* airline, const char* src,
+                           const char* dest, int time, Priority pri, Operation op, int procTime) {
+    Flight* newFlight = (Flight*)poolAlloc(pool);
+    if (!newFlight) {
+        printf("❌ Memory allocation failed!\n");
+        return NULL;
+    }
     
+    initFlight(newFlight, id, airline, src, dest, time, pri, op, procTime);
     return newFlight;
 }
 
@@ -62,8 +77,8 @@ void displayFlight(Flight* flight) {
     
     printf("┌─────────────────────────────────────────────────────────────┐\n");
     printf("│ Flight ID    : %-44s │\n", flight->flightID);
-    printf("│ Airline      : %-44s │\n", flight->airline);
-    printf("│ Route        : %s -> %-33s │\n", flight->source, flight->destination);
+    printf("│ Airline      : %-44s │\n", symbolToString(flight->airline));
+    printf("│ Route        : %s -> %-33s │\n", symbolToString(flight->source), symbolToString(flight->destination));
     printf("│ Time         : %-44s │\n", timeStr);
     printf("│ Operation    : %-44s │\n", operationToString(flight->operation));
     printf("│ Priority     : %-44s │\n", priorityToString(flight->priority));
@@ -178,6 +193,7 @@ const char* statusToString(Status s) {
         case WAITING: return "Waiting";
         case IN_PROGRESS: return "In Progress";
         case COMPLETED: return "Completed";
+        case CANCELLED: return "Cancelled";
         default: return "Unknown";
     }
 }
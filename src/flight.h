@@ -5,6 +5,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include "pool.h"
+#include "intern.h"
 
 // Flight priority levels (1-based for user input)
 typedef enum {
@@ -26,7 +28,8 @@ typedef enum {
 typedef enum {
     WAITING = 0,
     IN_PROGRESS = 1,
-    COMPLETED = 2
+    COMPLETED = 2,
+    CANCELLED = 3
 } Status;
 
 // Flight operation type
@@ -38,9 +41,9 @@ typedef enum {
 // Flight structure
 typedef struct Flight {
     char flightID[50];
-    char airline[50];
-    char source[50];
-    char destination[50];
+    SymbolID airline;     // Interned names (resolve with symbolToString)
+    SymbolID source;
+    SymbolID destination;
     int scheduledTime; // in minutes from midnight
     Priority priority;
     Status status;
@@ -48,12 +51,16 @@ typedef struct Flight {
     int processingTime; // time needed for landing/takeoff (in minutes)
     EmergencyType emergencyType; // Type of emergency
     char emergencyDetails[200]; // Details about the emergency
+    int tableIndex;      // Index in the scheduler's FlightTable (-1 until scheduled)
     struct Flight* next;
+    struct Flight* prev; // Only maintained by FlightRegistry
 } Flight;
 
 // Flight linked list functions
 Flight* createFlight(const char* id, const char* airline, const char* src, 
                      const char* dest, int time, Priority pri, Operation op, int procTime);
+Flight* createPooledFlight(MemoryPool* pool, const char* id, const char* airline, const char* src,
+                           const char* dest, int time, Priority pri, Operation op, int procTime);
 void addFlight(Flight** head, Flight* newFlight);
 void displayFlight(Flight* flight);
 void displayAllFlights(Flight* head);
@@ -0,0 +1,149 @@
+#include "flight_table.h"
+
+// Resize every column to newCapacity entries
+static int growFlightTable(FlightTable* table, int newCapacity) {
+    int* scheduledTime = (int*)realloc(table->scheduledTime, sizeof(int) * newCapacity);
+    if (scheduledTime) table->scheduledTime = scheduledTime;
+    int* processingTime = (int*)realloc(table->processingTime, sizeof(int) * newCapacity);
+    if (processingTime) table->processingTime = processingTime;
+    unsigned char* priority = (unsigned char*)realloc(table->priority, newCapacity);
+    if (priority) table->priority = priority;
+    unsigned char* emergencyType = (unsigned char*)realloc(table->emergencyType, newCapacity);
+    if (emergencyType) table->emergencyType = emergencyType;
+    unsigned char* status = (unsigned char*)realloc(table->status, newCapacity);
+    if (status) table->status = status;
+    unsigned char* operation = (unsigned char*)realloc(table->operation, newCapacity);
+    if (operation) table->operation = operation;
+    Flight** records = (Flight**)realloc(table->records, sizeof(Flight*) * newCapacity);
+    if (records) table->records = records;
+
+    if (!scheduledTime || !processingTime || !priority || !emergencyType ||
+        !status || !operation || !records) {
+        printf("❌ Memory allocation failed for flight table!\n");
+        return 0;
+    }
+    table->capacity = newCapacity;
+    return 1;
+}
+
+// Create an empty flight table
+FlightTable* createFlightTable(int initialCapacity) {
+    FlightTable* table = (FlightTable*)calloc(1, sizeof(FlightTable));
+    if (table == NULL) {
+        printf("❌ Memory allocation failed for flight table!\n");
+        return NULL;
+    }
+
+    if (!growFlightTable(table, initialCapacity > 0 ? initialCapacity : 64)) {
+        freeFlightTable(table);
+        return NULL;
+    }
+    return table;
+}
+
+// Make room for at least capacity rows (one resize for bulk loads)
+int reserveFlightTable(FlightTable* table, int capacity) {
+    if (table == NULL) return 0;
+    if (capacity <= table->capacity) return 1;
+
+    int newCapacity = table->capacity;
+    while (newCapacity < capacity) newCapacity *= 2;
+    return growFlightTable(table, newCapacity);
+}
+
+// Load the hot columns of one row from its record
+void refreshFlightFromRecord(FlightTable* table, FlightIndex index) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    Flight* flight = table->records[index];
+    if (flight == NULL) return;
+    table->scheduledTime[index] = flight->scheduledTime;
+    table->processingTime[index] = flight->processingTime;
+    table->priority[index] = (unsigned char)flight->priority;
+    table->emergencyType[index] = (unsigned char)flight->emergencyType;
+    table->status[index] = (unsigned char)flight->status;
+    table->operation[index] = (unsigned char)flight->operation;
+}
+
+// Append a flight and return its compact index
+FlightIndex addFlightToTable(FlightTable* table, Flight* flight) {
+    if (table == NULL || flight == NULL) return NO_FLIGHT;
+
+    if (table->count == table->capacity && !growFlightTable(table, table->capacity * 2)) {
+        return NO_FLIGHT;
+    }
+
+    FlightIndex index = table->count++;
+    table->records[index] = flight;
+    if (!table->sharedRecords) flight->tableIndex = index;
+    refreshFlightFromRecord(table, index);
+    return index;
+}
+
+// Cold record for an index
+Flight* getFlightRecord(FlightTable* table, FlightIndex index) {
+    if (table == NULL || index < 0 || index >= table->count) return NULL;
+    return table->records[index];
+}
+
+// Update status in the hot column and the record
+void setFlightStatus(FlightTable* table, FlightIndex index, Status status) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    table->status[index] = (unsigned char)status;
+    if (table->records[index] != NULL && !table->sharedRecords) table->records[index]->status = status;
+}
+
+// Update priority in the hot column and the record
+void setFlightPriority(FlightTable* table, FlightIndex index, Priority priority) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    table->priority[index] = (unsigned char)priority;
+    if (table->records[index] != NULL && !table->sharedRecords) table->records[index]->priority = priority;
+}
+
+// Update emergency type in the hot column and the record
+void setFlightEmergencyType(FlightTable* table, FlightIndex index, EmergencyType type) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    table->emergencyType[index] = (unsigned char)type;
+    if (table->records[index] != NULL && !table->sharedRecords) table->records[index]->emergencyType = type;
+}
+
+// Update processing time in the hot column and the record
+void setFlightProcessingTime(FlightTable* table, FlightIndex index, int processingTime) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    table->processingTime[index] = processingTime;
+    if (table->records[index] != NULL && !table->sharedRecords) table->records[index]->processingTime = processingTime;
+}
+
+// Update operation in the hot column and the record
+void setFlightOperation(FlightTable* table, FlightIndex index, Operation operation) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    table->operation[index] = (unsigned char)operation;
+    if (table->records[index] != NULL && !table->sharedRecords) table->records[index]->operation = operation;
+}
+
+// Forget the record of a row (its Flight is about to be freed)
+void detachFlightRecord(FlightTable* table, FlightIndex index) {
+    if (table == NULL || index < 0 || index >= table->count) return;
+
+    if (table->records[index] != NULL && !table->sharedRecords) table->records[index]->tableIndex = -1;
+    table->records[index] = NULL;
+}
+
+// Free the table (records are owned elsewhere)
+void freeFlightTable(FlightTable* table) {
+    if (table == NULL) return;
+
+    free(table->scheduledTime);
+    free(table->processingTime);
+    free(table->priority);
+    free(table->emergencyType);
+    free(table->status);
+    free(table->operation);
+    free(table->records);
+    free(table);
+}
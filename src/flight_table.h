@@ -0,0 +1,51 @@
+#ifndef FLIGHT_TABLE_H
+#define FLIGHT_TABLE_H
+
+#include "flight.h"
+
+// Compact handle of a flight inside a FlightTable
+typedef int FlightIndex;
+#define NO_FLIGHT (-1)
+
+// Structure-of-arrays flight table (hot/cold split).
+// The fields read on every scheduling step live in dense parallel arrays,
+// so heap comparisons and queue scans touch a few bytes per flight. Names
+// and emergency text stay in the Flight record (cold side table), reached
+// through the same index only when something is displayed or exported.
+// The hot columns are authoritative for a flight in the table: scheduling
+// reads only them, and they change only through the setters below. The
+// setters write through to the record, unless sharedRecords is set: then
+// several tables (e.g. one per algorithm in a comparison run) read the same
+// records at once, never write them, and the records keep their values from
+// when the flights were added. A record edited directly goes stale in the
+// other direction until refreshFlightFromRecord reloads its row.
+typedef struct FlightTable {
+    // Hot scheduling fields
+    int* scheduledTime;
+    int* processingTime;
+    unsigned char* priority;
+    unsigned char* emergencyType;
+    unsigned char* status;
+    unsigned char* operation;
+    // Cold side table
+    Flight** records;
+    int sharedRecords;  // Records are read-only: no write-through, no tableIndex
+    int count;
+    int capacity;
+} FlightTable;
+
+// Table operations
+FlightTable* createFlightTable(int initialCapacity);
+int reserveFlightTable(FlightTable* table, int capacity);
+FlightIndex addFlightToTable(FlightTable* table, Flight* flight);
+Flight* getFlightRecord(FlightTable* table, FlightIndex index);
+void refreshFlightFromRecord(FlightTable* table, FlightIndex index);
+void setFlightStatus(FlightTable* table, FlightIndex index, Status status);
+void setFlightPriority(FlightTable* table, FlightIndex index, Priority priority);
+void setFlightEmergencyType(FlightTable* table, FlightIndex index, EmergencyType type);
+void setFlightProcessingTime(FlightTable* table, FlightIndex index, int processingTime);
+void setFlightOperation(FlightTable* table, FlightIndex index, Operation operation);
+void detachFlightRecord(FlightTable* table, FlightIndex index);
+void freeFlightTable(FlightTable* table);
+
+#endif
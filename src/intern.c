@@ -0,0 +1,200 @@
+#include "intern.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+#define INTERN_MAX_LENGTH 49         // Same limit as the old inline name fields
+#define INTERN_CHUNK_SIZE 4096       // Text is packed into chunks of this size
+
+// Chunk of packed, NUL-terminated strings (never moved once written)
+typedef struct InternChunk {
+    struct InternChunk* next;
+    int used;
+    char text[INTERN_CHUNK_SIZE];
+} InternChunk;
+
+typedef struct InternTable {
+    const char** strings;      // symbol -> text
+    unsigned int* hashes;      // symbol -> hash
+    int count;
+    int capacity;
+    SymbolID* index;           // open-addressing hash index, 0 = empty slot
+    int indexCapacity;         // power of two
+    InternChunk* chunks;
+} InternTable;
+
+static InternTable table = {NULL, NULL, 0, 0, NULL, 0, NULL};
+
+// One lock for the whole table: lookups are short and schedulers running on
+// other threads intern names while flights are created
+#ifdef _WIN32
+static SRWLOCK tableLock = SRWLOCK_INIT;
+#define LOCK_TABLE() AcquireSRWLockExclusive(&tableLock)
+#define UNLOCK_TABLE() ReleaseSRWLockExclusive(&tableLock)
+#else
+static pthread_mutex_t tableLock = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_TABLE() pthread_mutex_lock(&tableLock)
+#define UNLOCK_TABLE() pthread_mutex_unlock(&tableLock)
+#endif
+
+// FNV-1a hash
+static unsigned int hashText(const char* text) {
+    unsigned int hash = 2166136261u;
+    while (*text) {
+        hash ^= (unsigned char)*text++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Copy text into chunk storage
+static const char* storeText(const char* text, int length) {
+    if (table.chunks == NULL || table.chunks->used + length + 1 > INTERN_CHUNK_SIZE) {
+        InternChunk* chunk = (InternChunk*)malloc(sizeof(InternChunk));
+        if (chunk == NULL) return NULL;
+        chunk->next = table.chunks;
+        chunk->used = 0;
+        table.chunks = chunk;
+    }
+    char* stored = table.chunks->text + table.chunks->used;
+    memcpy(stored, text, length);
+    stored[length] = '\0';
+    table.chunks->used += length + 1;
+    return stored;
+}
+
+// Rebuild the hash index at newCapacity slots
+static int growIndex(int newCapacity) {
+    SymbolID* index = (SymbolID*)calloc(newCapacity, sizeof(SymbolID));
+    if (index == NULL) return 0;
+
+    unsigned int mask = (unsigned int)newCapacity - 1;
+    for (int symbol = 1; symbol < table.count; symbol++) {
+        unsigned int slot = table.hashes[symbol] & mask;
+        while (index[slot] != EMPTY_SYMBOL) {
+            slot = (slot + 1) & mask;
+        }
+        index[slot] = (SymbolID)symbol;
+    }
+    free(table.index);
+    table.index = index;
+    table.indexCapacity = newCapacity;
+    return 1;
+}
+
+// Set up the table with symbol 0 = ""
+static int initInternTable() {
+    table.capacity = 256;
+    table.strings = (const char**)malloc(sizeof(const char*) * table.capacity);
+    table.hashes = (unsigned int*)malloc(sizeof(unsigned int) * table.capacity);
+    if (table.strings == NULL || table.hashes == NULL || !growIndex(512)) {
+        printf("❌ Memory allocation failed for intern table!\n");
+        return 0;
+    }
+    table.strings[EMPTY_SYMBOL] = "";
+    table.hashes[EMPTY_SYMBOL] = 0;
+    table.count = 1;
+    return 1;
+}
+
+// Lookup-or-insert with the table lock held
+static SymbolID internLocked(const char* text) {
+    if (table.strings == NULL && !initInternTable()) return EMPTY_SYMBOL;
+
+    int length = (int)strlen(text);
+    if (length > INTERN_MAX_LENGTH) length = INTERN_MAX_LENGTH;
+
+    char key[INTERN_MAX_LENGTH + 1];
+    memcpy(key, text, length);
+    key[length] = '\0';
+
+    unsigned int hash = hashText(key);
+    unsigned int mask = (unsigned int)table.indexCapacity - 1;
+    unsigned int slot = hash & mask;
+    while (table.index[slot] != EMPTY_SYMBOL) {
+        SymbolID symbol = table.index[slot];
+        if (table.hashes[symbol] == hash && strcmp(table.strings[symbol], key) == 0) {
+            return symbol;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // New symbol
+    if (table.count == table.capacity) {
+        int newCapacity = table.capacity * 2;
+        const char** strings = (const char**)realloc((void*)table.strings, sizeof(const char*) * newCapacity);
+        if (strings != NULL) table.strings = strings;
+        unsigned int* hashes = (unsigned int*)realloc(table.hashes, sizeof(unsigned int) * newCapacity);
+        if (hashes != NULL) table.hashes = hashes;
+        if (strings == NULL || hashes == NULL) {
+            printf("❌ Memory allocation failed for intern table!\n");
+            return EMPTY_SYMBOL;
+        }
+        table.capacity = newCapacity;
+    }
+
+    const char* stored = storeText(key, length);
+    if (stored == NULL) {
+        printf("❌ Memory allocation failed for intern table!\n");
+        return EMPTY_SYMBOL;
+    }
+
+    SymbolID symbol = (SymbolID)table.count++;
+    table.strings[symbol] = stored;
+    table.hashes[symbol] = hash;
+    table.index[slot] = symbol;
+
+    // Keep the index at most half full
+    if (table.count * 2 > table.indexCapacity) {
+        growIndex(table.indexCapacity * 2);
+    }
+    return symbol;
+}
+
+// Return the symbol for text, adding it on first use
+SymbolID internString(const char* text) {
+    if (text == NULL || text[0] == '\0') return EMPTY_SYMBOL;
+    LOCK_TABLE();
+    SymbolID symbol = internLocked(text);
+    UNLOCK_TABLE();
+    return symbol;
+}
+
+// Text of a symbol ("" for unknown symbols); the text itself never moves,
+// only the symbol -> text array does, so the lock covers just the lookup
+const char* symbolToString(SymbolID symbol) {
+    if (symbol == EMPTY_SYMBOL) return "";
+    LOCK_TABLE();
+    const char* text = (int)symbol < table.count ? table.strings[symbol] : "";
+    UNLOCK_TABLE();
+    return text;
+}
+
+// Number of distinct strings (including the empty string)
+int countSymbols() {
+    LOCK_TABLE();
+    int count = table.count;
+    UNLOCK_TABLE();
+    return count;
+}
+
+// Release all interned text (no other thread may be using the table)
+void freeInternTable() {
+    LOCK_TABLE();
+    InternChunk* chunk = table.chunks;
+    while (chunk != NULL) {
+        InternChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free((void*)table.strings);
+    free(table.hashes);
+    free(table.index);
+    memset(&table, 0, sizeof(table));
+    UNLOCK_TABLE();
+}
@@ -0,0 +1,18 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+// Global string intern table.
+// Each distinct airline/airport name is stored once and identified by a
+// 32-bit symbol, so flights compare names with a single integer compare and
+// resolve them back to text only for output. Symbol 0 is the empty string.
+// The table is shared by every scheduler and guarded by a lock, so flights
+// may be created on several threads at once.
+typedef unsigned int SymbolID;
+#define EMPTY_SYMBOL 0
+
+SymbolID internString(const char* text);
+const char* symbolToString(SymbolID symbol);
+int countSymbols();
+void freeInternTable();
+
+#endif
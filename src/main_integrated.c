@@ -11,7 +11,11 @@
 #include "flight.h"
 #include "queue.h"
 #include "scheduler.h"
+#include "registry.h"
 #include "api_bridge.h"
+#include "simulation.h"
+#include "algorithm_compare.h"
+#include "workload_generator.h"
 
 void displayMenu() {
     printf("\n");
@@ -47,42 +51,99 @@ void displayAlgorithmMenu() {
     printf("\nEnter choice (1-4): ");
 }
 
-void addSampleFlights(Flight** allFlights, Scheduler* scheduler) {
-    printf("\n Adding sample flights for demonstration...\n\n");
-    
-    Flight* f1 = createFlight("AI101", "AirIndia", "Delhi", "Mumbai", 600, SCHEDULED, LANDING, 8);
-    Flight* f2 = createFlight("6E202", "IndiGo", "Bangalore", "Delhi", 605, VIP, LANDING, 7);
-    Flight* f3 = createFlight("SG303", "SpiceJet", "Mumbai", "Kolkata", 610, SCHEDULED, TAKEOFF, 6);
-    Flight* f4 = createFlight("UK404", "Vistara", "Hyderabad", "Chennai", 615, SCHEDULED, TAKEOFF, 5);
-    Flight* f5 = createFlight("G8505", "GoAir", "Pune", "Goa", 620, EMERGENCY, LANDING, 9);
-    
-    if (f1 == NULL || f2 == NULL || f3 == NULL || f4 == NULL || f5 == NULL) {
-        printf(" Error creating sample flights!\n");
-        return;
+// Demo flights used by the menu, web mode and headless runs
+typedef struct SampleFlight {
+    const char* id;
+    const char* airline;
+    const char* source;
+    const char* destination;
+    int time;
+    Priority priority;
+    Operation operation;
+    int processingTime;
+} SampleFlight;
+
+#define SAMPLE_FLIGHT_COUNT 5
+
+static const SampleFlight sampleFlights[SAMPLE_FLIGHT_COUNT] = {
+    {"AI101", "AirIndia", "Delhi", "Mumbai", 600, SCHEDULED, LANDING, 8},
+    {"6E202", "IndiGo", "Bangalore", "Delhi", 605, VIP, LANDING, 7},
+    {"SG303", "SpiceJet", "Mumbai", "Kolkata", 610, SCHEDULED, TAKEOFF, 6},
+    {"UK404", "Vistara", "Hyderabad", "Chennai", 615, SCHEDULED, TAKEOFF, 5},
+    {"G8505", "GoAir", "Pune", "Goa", 620, EMERGENCY, LANDING, 9}
+};
+
+// Create the demo flights and admit them in bulk; returns how many were added
+static int loadSampleFlights(FlightRegistry* registry, Scheduler* scheduler) {
+    Flight* samples[SAMPLE_FLIGHT_COUNT];
+    for (int i = 0; i < SAMPLE_FLIGHT_COUNT; i++) {
+        const SampleFlight* s = &sampleFlights[i];
+        samples[i] = createPooledFlight(registry->flightPool, s->id, s->airline, s->source, s->destination,
+                                        s->time, s->priority, s->operation, s->processingTime);
+        if (samples[i] == NULL) {
+            printf(" Error creating sample flights!\n");
+            for (int j = 0; j < i; j++) poolFree(registry->flightPool, samples[j]);
+            return 0;
+        }
     }
     
-    addFlight(allFlights, f1);
-    addFlight(allFlights, f2);
-    addFlight(allFlights, f3);
-    addFlight(allFlights, f4);
-    addFlight(allFlights, f5);
-    
-    addFlightToScheduler(scheduler, f1);
-    addFlightToScheduler(scheduler, f2);
-    addFlightToScheduler(scheduler, f3);
-    addFlightToScheduler(scheduler, f4);
-    addFlightToScheduler(scheduler, f5);
+    // One bulk admission; samples already in the registry (e.g. added twice)
+    // are moved behind the accepted ones and released
+    int added = addFlightsToSchedulerBulk(scheduler, samples, SAMPLE_FLIGHT_COUNT);
+    for (int i = added; i < SAMPLE_FLIGHT_COUNT; i++) {
+        poolFree(registry->flightPool, samples[i]);
+    }
+    return added;
+}
+
+// The demo flights as a workload for comparison runs (all queued up front,
+// as loadSampleFlights does)
+static Workload* sampleWorkload() {
+    Workload* workload = createWorkload();
+    if (workload == NULL) return NULL;
+    workload->preloaded = 1;
+    for (int i = 0; i < SAMPLE_FLIGHT_COUNT; i++) {
+        const SampleFlight* s = &sampleFlights[i];
+        addWorkloadFlight(workload, s->id, s->airline, s->source, s->destination,
+                          s->time, s->priority, s->operation, s->processingTime);
+    }
+    return workload;
+}
+
+void addSampleFlights(FlightRegistry* registry, Scheduler* scheduler) {
+    printf("\n Adding sample flights for demonstration...\n\n");
     
-    printf("\n✅ 5 sample flights added successfully!\n");
+    int added = loadSampleFlights(registry, scheduler);
+    printf("\n✅ %d sample flights added successfully!\n", added);
     
     // Export to JSON for web dashboard
-    exportAllDataJSON(scheduler, *allFlights);
+    exportAllDataJSON(scheduler, registry);
     printf("📤 Data exported to web dashboard\n");
     
     sleep(2);
 }
 
-void webDashboardMode(Scheduler* scheduler, Flight** allFlights) {
+// Web mode paces 500 ms per simulated minute (120x real time)
+#define WEB_MODE_SPEED 120.0
+
+// Web mode: export every simulated minute
+static void webModeStep(Simulation* sim, int fromTime, int toTime, void* context) {
+    (void)fromTime;
+    (void)toTime;
+    exportAllDataJSON(sim->scheduler, (FlightRegistry*)context);
+    printf(".");
+    fflush(stdout);
+}
+
+// Menu simulation: export every 5 minutes
+static void menuSimulationStep(Simulation* sim, int fromTime, int toTime, void* context) {
+    (void)fromTime;
+    if (toTime % 5 == 0) {
+        exportAllDataJSON(sim->scheduler, (FlightRegistry*)context);
+    }
+}
+
+void webDashboardMode(Scheduler* scheduler, FlightRegistry* registry) {
     printf("\n");
     printf("=================================================================\n");
     printf("                   WEB DASHBOARD MODE ACTIVE                     \n");
@@ -104,7 +165,7 @@ void webDashboardMode(Scheduler* scheduler, Flight** allFlights) {
     printf("\n");
     
     // Initial export
-    exportAllDataJSON(scheduler, *allFlights);
+    exportAllDataJSON(scheduler, registry);
     printf(" Initial data exported\n");
     
     int running = 1;
@@ -123,25 +184,18 @@ void webDashboardMode(Scheduler* scheduler, Flight** allFlights) {
                     printf("  Starting simulation...\n");
                     simulating = 1;
                     
-                    // Run simulation for 30 minutes
-                    for (int i = 0; i < 30 && simulating; i++) {
-                        processScheduling(scheduler);
-                        scheduler->currentTime++;
-                        
-                        // Export data every minute
-                        exportAllDataJSON(scheduler, *allFlights);
-                        
-                        printf(".");
-                        fflush(stdout);
-                        
-                        #ifdef _WIN32
-                            Sleep(500);
-                        #else
-                            usleep(500000);
-                        #endif
+                    // Run simulation for 30 minutes, exporting data every minute
+                    VirtualClock clock;
+                    initVirtualClock(&clock, CLOCK_SCALED, WEB_MODE_SPEED);
+                    Simulation* sim = createSimulation(scheduler);
+                    if (sim != NULL) {
+                        sim->clock = &clock;
+                        setSimulationHook(sim, webModeStep, registry, 1);
+                        runSimulationUntil(sim, scheduler->currentTime + 30);
+                        freeSimulation(sim);
                     }
                     printf("\n✅ Simulation segment completed\n");
-                    exportAllDataJSON(scheduler, *allFlights);
+                    exportAllDataJSON(scheduler, registry);
                 }
                 break;
                 
@@ -153,13 +207,13 @@ void webDashboardMode(Scheduler* scheduler, Flight** allFlights) {
                 
             case 'a':
             case 'A':
-                addSampleFlights(allFlights, scheduler);
+                addSampleFlights(registry, scheduler);
                 break;
                 
             case 'e':
             case 'E':
                 handleEmergency(scheduler);
-                exportAllDataJSON(scheduler, *allFlights);
+                exportAllDataJSON(scheduler, registry);
                 printf("📤 Emergency flight data exported\n");
                 break;
                 
@@ -175,8 +229,165 @@ void webDashboardMode(Scheduler* scheduler, Flight** allFlights) {
     }
 }
 
-int main() {
-    Flight* allFlights = NULL;
+void printUsage(const char* program) {
+    printf("Usage: %s [--simulate <minutes> [--algo <1-4> | --compare [--generate <n> [--seed <s>]]] [--speed <x|wall|max>] [--runways <n|LTM...>] [--max-dispatch <n>] [--preempt] [--quiet] [--completion-log <file>]]\n", program);
+    printf("  --simulate <minutes>  Run the sample schedule without menus, then print statistics\n");
+    printf("  --compare             Run all four algorithms on the schedule in parallel and compare them\n");
+    printf("  --generate <n>        Compare on n generated flights from midnight instead of the sample schedule\n");
+    printf("  --seed <s>            Seed of the generated flights (default 1); a seed always gives the same flights\n");
+    printf("  --algo <n>            1 FCFS, 2 Priority, 3 SJF, 4 Round Robin (default 1)\n");
+    printf("  --speed <x>           x times real time, 'wall' to follow the clock, 'max' (default) for no pacing\n");
+    printf("  --runways <n|LTM...>  n mixed runways, or one letter per runway: L landings, T takeoffs, M mixed\n");
+    printf("  --max-dispatch <n>    Flights put on runways per minute (default 0 = every free runway)\n");
+    printf("  --preempt             Emergencies may bump a takeoff that has not started rolling\n");
+    printf("  --quiet               Do not print per-flight messages\n");
+    printf("  --completion-log <f>  Append every completed operation to file f (tab-separated text, one line each)\n");
+}
+
+// Parse a --runways value into the config (returns 0 if it is invalid)
+static int parseRunwaySpec(const char* spec, SchedulerConfig* config) {
+    if (spec[0] >= '0' && spec[0] <= '9') {
+        config->runwayCount = atoi(spec);
+        return config->runwayCount >= 1 && config->runwayCount <= MAX_RUNWAYS;
+    }
+    
+    int count = 0;
+    for (const char* c = spec; *c != '\0'; c++) {
+        if (count == MAX_RUNWAYS) return 0;
+        switch (*c) {
+            case 'L': case 'l': config->runwayOperations[count++] = RUNWAY_LANDINGS; break;
+            case 'T': case 't': config->runwayOperations[count++] = RUNWAY_TAKEOFFS; break;
+            case 'M': case 'm': config->runwayOperations[count++] = RUNWAY_MIXED; break;
+            default: return 0;
+        }
+    }
+    config->runwayCount = count;
+    return count > 0;
+}
+
+// Non-interactive batch run: --simulate <minutes> --algo <n> --speed <x>
+int runCommandLine(int argc, char* argv[]) {
+    int minutes = -1, algo = 1, quiet = 0, compare = 0, generate = 0;
+    unsigned long long seed = 1;
+    const char* completionLogPath = NULL;
+    ClockMode mode = CLOCK_AS_FAST_AS_POSSIBLE;
+    double speed = 0;
+    SchedulerConfig config = defaultSchedulerConfig(FCFS);
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--simulate") == 0 && i + 1 < argc) {
+            minutes = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--algo") == 0 && i + 1 < argc) {
+            algo = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "wall") == 0) {
+                mode = CLOCK_WALL_SYNCED;
+            } else if (strcmp(argv[i], "max") == 0) {
+                mode = CLOCK_AS_FAST_AS_POSSIBLE;
+            } else {
+                speed = atof(argv[i]);
+                mode = speed > 0 ? CLOCK_SCALED : CLOCK_AS_FAST_AS_POSSIBLE;
+            }
+        } else if (strcmp(argv[i], "--runways") == 0 && i + 1 < argc) {
+            if (!parseRunwaySpec(argv[++i], &config)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--max-dispatch") == 0 && i + 1 < argc) {
+            config.maxDispatchPerTick = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--preempt") == 0) {
+            config.emergencyPreemption = 1;
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = 1;
+        } else if (strcmp(argv[i], "--compare") == 0) {
+            compare = 1;
+        } else if (strcmp(argv[i], "--generate") == 0 && i + 1 < argc) {
+            generate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--completion-log") == 0 && i + 1 < argc) {
+            completionLogPath = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (minutes < 1 || algo < 1 || algo > 4 || config.maxDispatchPerTick < 0 || generate < 0 ||
+        (generate > 0 && !compare)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    
+    // Comparison: as fast as possible, no per-flight output, no exports
+    if (compare) {
+        int start = 600;    // Schedulers start at 10:00
+        Workload* workload = NULL;
+        if (generate > 0) {
+            WorkloadSpec spec = defaultWorkloadSpec(generate, seed);
+            workload = generateWorkload(&spec);
+            start = spec.startTime;
+        } else {
+            workload = sampleWorkload();
+        }
+        if (workload == NULL) return 1;
+        AlgorithmReport reports[COMPARED_ALGORITHMS];
+        int count = compareAlgorithms(workload, config, start, start + minutes, COMPARED_ALGORITHMS, reports);
+        displayAlgorithmComparison(reports, count);
+        freeWorkload(workload);
+        freeInternTable();
+        return count > 0 ? 0 : 1;
+    }
+    
+    #ifdef _WIN32
+        system("if not exist data mkdir data");
+    #else
+        system("mkdir -p data");
+    #endif
+    
+    config.algorithm = (SchedulingAlgorithm)algo;
+    Scheduler* scheduler = createSchedulerWithConfig(config);
+    FlightRegistry* registry = createFlightRegistry();
+    if (scheduler == NULL || registry == NULL) {
+        printf(" Failed to create scheduler!\n");
+        freeScheduler(scheduler);
+        freeFlightRegistry(registry);
+        return 1;
+    }
+    scheduler->registry = registry;
+    scheduler->verbose = !quiet;
+    if (completionLogPath != NULL && !openCompletionSpill(scheduler->completionLog, completionLogPath)) {
+        freeFlightRegistry(registry);
+        freeScheduler(scheduler);
+        return 1;
+    }
+    
+    // A wall-synced run starts at the current time of day
+    if (mode == CLOCK_WALL_SYNCED) {
+        setSchedulerTime(scheduler, currentMinuteOfDay());
+    }
+    
+    loadSampleFlights(registry, scheduler);
+    
+    VirtualClock clock;
+    initVirtualClock(&clock, mode, speed);
+    simulateFor(scheduler, minutes, &clock);
+    
+    generateStatistics(scheduler);
+    exportAllDataJSON(scheduler, registry);
+    
+    freeFlightRegistry(registry);
+    freeScheduler(scheduler);
+    freeInternTable();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return runCommandLine(argc, argv);
+    }
+    
+    FlightRegistry* registry = NULL;
     Scheduler* scheduler = NULL;
     int choice, algo;
     
@@ -214,6 +425,14 @@ int main() {
         return 1;
     }
     
+    registry = createFlightRegistry();
+    if (registry == NULL) {
+        printf(" Failed to create flight registry!\n");
+        freeScheduler(scheduler);
+        return 1;
+    }
+    scheduler->registry = registry;
+    
     printf("\n Scheduler initialized with ");
     switch(scheduler->algorithm) {
         case FCFS: printf("FCFS algorithm.\n"); break;
@@ -231,7 +450,7 @@ int main() {
     while(getchar() != '\n');
     
     if (sampleChoice == 'y' || sampleChoice == 'Y') {
-        addSampleFlights(&allFlights, scheduler);
+        addSampleFlights(registry, scheduler);
     }
     
     // Main menu loop
@@ -308,13 +527,14 @@ int main() {
                 }
                 while(getchar() != '\n');
                 
-                Flight* newFlight = createFlight(id, airline, src, dest, time, 
-                                                (Priority)pri, (Operation)op, procTime);
-                if (newFlight != NULL) {
-                    addFlight(&allFlights, newFlight);
+                Flight* newFlight = createPooledFlight(registry->flightPool, id, airline, src, dest, time, 
+                                                      (Priority)pri, (Operation)op, procTime);
+                if (newFlight != NULL && !addFlightToRegistry(registry, newFlight)) {
+                    poolFree(registry->flightPool, newFlight);
+                } else if (newFlight != NULL) {
                     addFlightToScheduler(scheduler, newFlight);
                     printf("\n✅ Flight %s added successfully!\n", id);
-                    exportAllDataJSON(scheduler, allFlights);
+                    exportAllDataJSON(scheduler, registry);
                     printf("📤 Data exported to web dashboard\n");
                 } else {
                     printf("\n Failed to create flight!\n");
@@ -325,7 +545,7 @@ int main() {
             }
             
             case 2: {
-                displayAllFlights(allFlights);
+                displayRegistryFlights(registry);
                 printf("\nPress Enter to continue...");
                 getchar();
                 break;
@@ -342,8 +562,13 @@ int main() {
                 }
                 while(getchar() != '\n');
                 
-                deleteFlight(&allFlights, id);
-                exportAllDataJSON(scheduler, allFlights);
+                // Pull it out of the scheduler first so no queue keeps its handle
+                Flight* doomed = findFlightInRegistry(registry, id);
+                if (doomed != NULL) {
+                    cancelScheduledFlight(scheduler, doomed->tableIndex);
+                }
+                deleteFlightFromRegistry(registry, id);
+                exportAllDataJSON(scheduler, registry);
                 printf("Press Enter to continue...");
                 getchar();
                 break;
@@ -360,7 +585,7 @@ int main() {
                 }
                 while(getchar() != '\n');
                 
-                Flight* found = findFlight(allFlights, id);
+                Flight* found = findFlightInRegistry(registry, id);
                 if (found != NULL) {
                     printf("\n Flight found!\n");
                     displayFlight(found);
@@ -393,24 +618,18 @@ int main() {
                 printf("\n Starting simulation...\n");
                 printf("Tip: Open web dashboard to see live updates!\n\n");
                 
-                int endTime = scheduler->currentTime + duration;
-                while (scheduler->currentTime < endTime) {
-                    processScheduling(scheduler);
-                    scheduler->currentTime++;
-                    
-                    // Export every 5 minutes
-                    if (scheduler->currentTime % 5 == 0) {
-                        exportAllDataJSON(scheduler, allFlights);
-                    }
-                    
-                    #ifdef _WIN32
-                        Sleep(100);
-                    #else
-                        usleep(100000);
-                    #endif
+                // Event-driven run that still stops every 5 minutes to export
+                VirtualClock clock;
+                initVirtualClock(&clock, CLOCK_SCALED, VISUAL_SIMULATION_SPEED);
+                Simulation* sim = createSimulation(scheduler);
+                if (sim != NULL) {
+                    sim->clock = &clock;
+                    setSimulationHook(sim, menuSimulationStep, registry, 5);
+                    runSimulationUntil(sim, scheduler->currentTime + duration);
+                    freeSimulation(sim);
                 }
                 
-                exportAllDataJSON(scheduler, allFlights);
+                exportAllDataJSON(scheduler, registry);
                 printf("\n Simulation completed!\n");
                 printf(" Final data exported to web dashboard\n");
                 printf("\nPress Enter to continue...");
@@ -420,7 +639,7 @@ int main() {
             
             case 7: {
                 handleEmergency(scheduler);
-                exportAllDataJSON(scheduler, allFlights);
+                exportAllDataJSON(scheduler, registry);
                 printf("📤 Emergency data exported\n");
                 printf("\nPress Enter to continue...");
                 getchar();
@@ -429,6 +648,7 @@ int main() {
             
             case 8: {
                 generateStatistics(scheduler);
+                displayMemoryPoolStats(registry->flightPool, "Flight pool");
                 printf("\nPress Enter to continue...");
                 getchar();
                 break;
@@ -465,9 +685,9 @@ int main() {
                 while(getchar() != '\n');
                 
                 if (algo >= 1 && algo <= 4) {
-                    scheduler->algorithm = (SchedulingAlgorithm)algo;
+                    setSchedulingAlgorithm(scheduler, (SchedulingAlgorithm)algo);
                     printf("\n Algorithm changed successfully!\n");
-                    exportAllDataJSON(scheduler, allFlights);
+                    exportAllDataJSON(scheduler, registry);
                 } else {
                     printf("\n Invalid choice!\n");
                 }
@@ -477,7 +697,7 @@ int main() {
             }
             
             case 11: {
-                webDashboardMode(scheduler, &allFlights);
+                webDashboardMode(scheduler, registry);
                 break;
             }
             
@@ -485,8 +705,9 @@ int main() {
                 printf("\n Thank you for using Airport Runway Scheduling System!\n");
                 printf("Cleaning up resources...\n");
                 
-                freeFlightList(&allFlights);
+                freeFlightRegistry(registry);
                 freeScheduler(scheduler);
+                freeInternTable();
                 
                 printf(" Goodbye!\n\n");
                 return 0;
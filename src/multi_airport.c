@@ -0,0 +1,310 @@
+#include "multi_airport.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Create a runner with threads workers (airports are added afterwards)
+AirportRunner* createAirportRunner(int threads) {
+    AirportRunner* runner = (AirportRunner*)calloc(1, sizeof(AirportRunner));
+    if (runner == NULL) {
+        printf("❌ Memory allocation failed for airport runner!\n");
+        return NULL;
+    }
+    runner->workers = createWorkerPool(threads);
+    if (runner->workers == NULL) {
+        free(runner);
+        return NULL;
+    }
+    return runner;
+}
+
+// Add an airport with its own scheduler; all airports start at the runner's time.
+// Airports must all be added before connectAirports.
+Airport* addAirport(AirportRunner* runner, const char* code, SchedulerConfig config) {
+    if (runner == NULL || code == NULL) return NULL;
+    if (runner->networked) {
+        printf("❌ Cannot add airport %s: the airports are already connected!\n", code);
+        return NULL;
+    }
+
+    if (runner->airportCount == runner->airportCapacity) {
+        int newCapacity = runner->airportCapacity > 0 ? runner->airportCapacity * 2 : 8;
+        Airport** airports = (Airport**)realloc(runner->airports, sizeof(Airport*) * newCapacity);
+        if (airports == NULL) {
+            printf("❌ Memory allocation failed for airport list!\n");
+            return NULL;
+        }
+        runner->airports = airports;
+        runner->airportCapacity = newCapacity;
+    }
+
+    Airport* airport = (Airport*)calloc(1, sizeof(Airport));
+    if (airport == NULL) {
+        printf("❌ Memory allocation failed for airport %s!\n", code);
+        return NULL;
+    }
+    strncpy(airport->code, code, sizeof(airport->code) - 1);
+    airport->codeSymbol = internString(airport->code);
+    airport->runner = runner;
+    airport->scheduler = createSchedulerWithConfig(config);
+    airport->flightPool = createMemoryPool(sizeof(Flight), 1024);
+    airport->sim = airport->scheduler != NULL ? createSimulation(airport->scheduler) : NULL;
+    if (airport->scheduler == NULL || airport->flightPool == NULL || airport->sim == NULL) {
+        freeSimulation(airport->sim);
+        freeScheduler(airport->scheduler);
+        destroyMemoryPool(airport->flightPool);
+        free(airport);
+        return NULL;
+    }
+    airport->scheduler->verbose = 0;
+    setSchedulerTime(airport->scheduler, runner->currentTime);
+
+    airport->index = runner->airportCount;
+    runner->airports[runner->airportCount++] = airport;
+    return airport;
+}
+
+// Airport by code, NULL if unknown
+Airport* findAirport(AirportRunner* runner, const char* code) {
+    if (runner == NULL || code == NULL) return NULL;
+    for (int i = 0; i < runner->airportCount; i++) {
+        if (strcmp(runner->airports[i]->code, code) == 0) return runner->airports[i];
+    }
+    return NULL;
+}
+
+// ==================== NETWORK MODE ====================
+
+// Completion hook: park takeoffs bound for another airport of the runner
+static void networkDeparture(Scheduler* scheduler, Flight* flight, int runwayIndex, void* context) {
+    (void)runwayIndex;
+    Airport* airport = (Airport*)context;
+    AirportRunner* runner = airport->runner;
+    if (flight->operation != TAKEOFF) return;
+
+    // A handful of airports: a linear scan beats hashing here (only
+    // airports in the route table can be flown to)
+    int destination = -1;
+    for (int i = 0; i < runner->routeAirports; i++) {
+        if (runner->airports[i]->codeSymbol == flight->destination) {
+            destination = i;
+            break;
+        }
+    }
+    if (destination < 0 || destination == airport->index) return;
+
+    if (airport->outboxCount == airport->outboxCapacity) {
+        int newCapacity = airport->outboxCapacity > 0 ? airport->outboxCapacity * 2 : 64;
+        NetworkTransfer* outbox = (NetworkTransfer*)realloc(airport->outbox, sizeof(NetworkTransfer) * newCapacity);
+        if (outbox == NULL) {
+            printf("❌ Memory allocation failed for %s departures!\n", airport->code);
+            return;
+        }
+        airport->outbox = outbox;
+        airport->outboxCapacity = newCapacity;
+    }
+
+    int minutes = runner->routeMinutes[airport->index * runner->routeAirports + destination];
+    NetworkTransfer* transfer = &airport->outbox[airport->outboxCount++];
+    transfer->flight = flight;
+    transfer->destination = destination;
+    transfer->arrivalTime = scheduler->currentTime + minutes;
+    airport->departuresSent++;
+}
+
+// Couple the airports added so far: every pair flightMinutes apart until
+// changed with setRouteFlightTime. Returns 0 on failure.
+int connectAirports(AirportRunner* runner, int flightMinutes) {
+    if (runner == NULL || runner->airportCount == 0) return 0;
+    if (flightMinutes < 1) {
+        printf("❌ Flight time must be at least 1 minute!\n");
+        return 0;
+    }
+
+    int count = runner->airportCount;
+    int* routes = (int*)malloc(sizeof(int) * count * count);
+    if (routes == NULL) {
+        printf("❌ Memory allocation failed for route table!\n");
+        return 0;
+    }
+    for (int i = 0; i < count * count; i++) {
+        routes[i] = flightMinutes;
+    }
+    free(runner->routeMinutes);
+    runner->routeMinutes = routes;
+    runner->routeAirports = count;
+    runner->lookahead = flightMinutes;
+    runner->networked = 1;
+
+    for (int i = 0; i < count; i++) {
+        setFlightCompleteHook(runner->airports[i]->scheduler, networkDeparture, runner->airports[i]);
+    }
+    return 1;
+}
+
+// Flight time for one direction of a route (both airports must be connected)
+void setRouteFlightTime(AirportRunner* runner, const char* from, const char* to, int minutes) {
+    if (runner == NULL || !runner->networked) return;
+    Airport* source = findAirport(runner, from);
+    Airport* destination = findAirport(runner, to);
+    if (source == NULL || destination == NULL ||
+        source->index >= runner->routeAirports || destination->index >= runner->routeAirports) {
+        printf("❌ Unknown route %s -> %s!\n", from != NULL ? from : "?", to != NULL ? to : "?");
+        return;
+    }
+    if (minutes < 1) {
+        printf("❌ Flight time must be at least 1 minute!\n");
+        return;
+    }
+
+    runner->routeMinutes[source->index * runner->routeAirports + destination->index] = minutes;
+
+    // The lookahead is the shortest route
+    runner->lookahead = minutes;
+    for (int i = 0; i < runner->routeAirports * runner->routeAirports; i++) {
+        if (runner->routeMinutes[i] < runner->lookahead) runner->lookahead = runner->routeMinutes[i];
+    }
+}
+
+// Window boundary: land every parked departure at its destination, in
+// airport order then departure order
+static void deliverTransfers(AirportRunner* runner) {
+    for (int i = 0; i < runner->airportCount; i++) {
+        Airport* source = runner->airports[i];
+        for (int t = 0; t < source->outboxCount; t++) {
+            NetworkTransfer* transfer = &source->outbox[t];
+            Airport* destination = runner->airports[transfer->destination];
+
+            Flight* landing = (Flight*)poolAlloc(destination->flightPool);
+            if (landing == NULL) {
+                printf("❌ Memory allocation failed for arriving flight!\n");
+                continue;
+            }
+            *landing = *transfer->flight;
+            landing->scheduledTime = transfer->arrivalTime;
+            landing->status = WAITING;
+            landing->operation = LANDING;
+            landing->emergencyType = NO_EMERGENCY;
+            strcpy(landing->emergencyDetails, "None");
+            landing->tableIndex = -1;
+            landing->next = NULL;
+            landing->prev = NULL;
+
+            scheduleArrival(destination->sim, landing, transfer->arrivalTime);
+            destination->arrivalsReceived++;
+            runner->transfersDelivered++;
+        }
+        source->outboxCount = 0;
+    }
+}
+
+// Create a flight in the airport's pool; it joins the queues at time
+Flight* scheduleAirportFlight(Airport* airport, const char* id, const char* airline, const char* src,
+                              const char* dest, int time, Priority priority, Operation operation,
+                              int processingTime) {
+    if (airport == NULL) return NULL;
+    Flight* flight = createPooledFlight(airport->flightPool, id, airline, src, dest, time,
+                                       priority, operation, processingTime);
+    if (flight != NULL) {
+        scheduleArrival(airport->sim, flight, time);
+    }
+    return flight;
+}
+
+// Worker task: advance one airport to the end of the current window
+static void advanceAirport(void* arg) {
+    Airport* airport = (Airport*)arg;
+    double start = wallClockMs();
+    runSimulationUntil(airport->sim, airport->runUntil);
+    airport->busyMs += wallClockMs() - start;
+}
+
+// Advance every airport to endTime, window by window, in parallel
+void runAirportsUntil(AirportRunner* runner, int endTime) {
+    if (runner == NULL) return;
+    double start = wallClockMs();
+
+    int window = runner->windowMinutes;
+    if (runner->networked && (window <= 0 || window > runner->lookahead)) {
+        window = runner->lookahead;
+    }
+
+    while (runner->currentTime < endTime) {
+        if (runner->networked) deliverTransfers(runner);
+
+        int windowEnd = endTime;
+        if (window > 0 && runner->currentTime + window < endTime) {
+            windowEnd = runner->currentTime + window;
+        }
+        for (int i = 0; i < runner->airportCount; i++) {
+            runner->airports[i]->runUntil = windowEnd;
+            submitWork(runner->workers, advanceAirport, runner->airports[i]);
+        }
+        waitForWorkers(runner->workers);
+        runner->currentTime = windowEnd;
+        runner->windowsRun++;
+    }
+
+    // Complete the operations due exactly at the end time, as simulateFor does
+    for (int i = 0; i < runner->airportCount; i++) {
+        completeDueOperations(runner->airports[i]->scheduler);
+    }
+    runner->wallMs = wallClockMs() - start;
+}
+
+// Flights completed across all airports
+int countAirportMovements(AirportRunner* runner) {
+    if (runner == NULL) return 0;
+    int movements = 0;
+    for (int i = 0; i < runner->airportCount; i++) {
+        movements += runner->airports[i]->scheduler->totalFlightsProcessed;
+    }
+    return movements;
+}
+
+// Per-airport results and aggregate throughput of the last run
+void displayAirportRunnerSummary(AirportRunner* runner) {
+    if (runner == NULL) return;
+
+    printf("\n╔═══════════════════════════════════════════════════════════════╗\n");
+    printf("║                   MULTI-AIRPORT RUN SUMMARY                   ║\n");
+    printf("╚═══════════════════════════════════════════════════════════════╝\n\n");
+    printf("%-8s | %9s | %8s | %8s | %8s\n", "airport", "processed", "avg wait", "runways", "busy ms");
+    for (int i = 0; i < runner->airportCount; i++) {
+        Airport* airport = runner->airports[i];
+        Scheduler* scheduler = airport->scheduler;
+        double avgWait = scheduler->totalFlightsProcessed > 0
+            ? (double)scheduler->totalWaitingTime / scheduler->totalFlightsProcessed : 0.0;
+        printf("%-8s | %9d | %8.2f | %8d | %8.2f\n", airport->code, scheduler->totalFlightsProcessed,
+               avgWait, scheduler->runwayCount, airport->busyMs);
+    }
+
+    int movements = countAirportMovements(runner);
+    printf("\n📊 Airports: %d | Threads: %d | Windows: %d\n",
+           runner->airportCount, runner->workers->threadCount, runner->windowsRun);
+    printf("✈️  Movements: %d in %.2f ms (%.0f movements/s, %ld airport steps stolen)\n",
+           movements, runner->wallMs,
+           runner->wallMs > 0 ? movements * 1000.0 / runner->wallMs : 0.0,
+           countStolenTasks(runner->workers));
+    if (runner->networked) {
+        printf("🔗 Network: %ld flights handed between airports (lookahead %d min)\n",
+               runner->transfersDelivered, runner->lookahead);
+    }
+}
+
+// Stop the workers and free every airport with its flights
+void freeAirportRunner(AirportRunner* runner) {
+    if (runner == NULL) return;
+    freeWorkerPool(runner->workers);
+    for (int i = 0; i < runner->airportCount; i++) {
+        Airport* airport = runner->airports[i];
+        freeSimulation(airport->sim);
+        freeScheduler(airport->scheduler);
+        destroyMemoryPool(airport->flightPool);
+        free(airport->outbox);
+        free(airport);
+    }
+    free(runner->airports);
+    free(runner->routeMinutes);
+    free(runner);
+}
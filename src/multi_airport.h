@@ -0,0 +1,80 @@
+#ifndef MULTI_AIRPORT_H
+#define MULTI_AIRPORT_H
+
+#include "scheduler.h"
+#include "simulation.h"
+#include "worker_pool.h"
+
+// Multi-airport runner.
+// Each airport is an independent Scheduler + Simulation with its own
+// flights, resources and flight pool, so airports share nothing but the
+// (locked) intern table. runAirportsUntil advances every airport through
+// the same simulated window in parallel: one task per airport per window on
+// a work-stealing worker pool, so a busy airport keeps one worker busy while
+// the others steal the quiet airports. Schedulers run with verbose off;
+// interleaved console output from several threads is unreadable.
+//
+// Network mode (connectAirports) couples the airports: a takeoff completed
+// at one airport whose destination is another airport of the runner lands
+// there flightMinutes later. Airports still run on separate threads and only
+// meet at window boundaries. The window is never longer than the shortest
+// flight time (the lookahead), so a departure inside a window always
+// arrives in a later window. A takeoff is parked in its source airport's
+// outbox (written only by that airport's thread, no lock needed). Between
+// windows the runner hands every outbox entry to its destination in a fixed
+// order, so results do not depend on the thread count.
+typedef struct NetworkTransfer {
+    Flight* flight;           // Completed takeoff (owned by the source airport)
+    int destination;          // Airport index
+    int arrivalTime;
+} NetworkTransfer;
+
+struct AirportRunner;
+
+typedef struct Airport {
+    char code[8];
+    SymbolID codeSymbol;      // Matched against flight destinations
+    int index;
+    struct AirportRunner* runner;
+    Scheduler* scheduler;
+    Simulation* sim;
+    MemoryPool* flightPool;   // Flights created for this airport
+    int runUntil;             // End of the window being simulated
+    double busyMs;            // Wall time spent advancing this airport
+    NetworkTransfer* outbox;  // Network mode: departures waiting for the next window boundary
+    int outboxCount;
+    int outboxCapacity;
+    int departuresSent;
+    int arrivalsReceived;
+} Airport;
+
+typedef struct AirportRunner {
+    Airport** airports;
+    int airportCount;
+    int airportCapacity;
+    WorkerPool* workers;
+    int windowMinutes;        // Airports line up every windowMinutes (0 = whole run in one window)
+    int currentTime;
+    int windowsRun;
+    double wallMs;            // Wall time of the last runAirportsUntil
+    int networked;
+    int* routeMinutes;        // routeAirports x routeAirports flight times (network mode)
+    int routeAirports;
+    int lookahead;            // Shortest flight time: upper bound for the window
+    long transfersDelivered;
+} AirportRunner;
+
+AirportRunner* createAirportRunner(int threads);
+Airport* addAirport(AirportRunner* runner, const char* code, SchedulerConfig config);
+Airport* findAirport(AirportRunner* runner, const char* code);
+int connectAirports(AirportRunner* runner, int flightMinutes);
+void setRouteFlightTime(AirportRunner* runner, const char* from, const char* to, int minutes);
+Flight* scheduleAirportFlight(Airport* airport, const char* id, const char* airline, const char* src,
+                              const char* dest, int time, Priority priority, Operation operation,
+                              int processingTime);
+void runAirportsUntil(AirportRunner* runner, int endTime);
+int countAirportMovements(AirportRunner* runner);
+void displayAirportRunnerSummary(AirportRunner* runner);
+void freeAirportRunner(AirportRunner* runner);
+
+#endif
@@ -0,0 +1,158 @@
+#include "pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Slot memory starts right after the slab header, kept 16-byte aligned
+#define SLAB_HEADER_SIZE ((sizeof(Slab) + 15) & ~(size_t)15)
+
+static char* slabSlots(Slab* slab) {
+    return (char*)slab + SLAB_HEADER_SIZE;
+}
+
+// Create a pool of slotSize-byte slots
+MemoryPool* createMemoryPool(size_t slotSize, int slotsPerSlab) {
+    MemoryPool* pool = (MemoryPool*)malloc(sizeof(MemoryPool));
+    if (pool == NULL) {
+        printf("❌ Memory allocation failed for memory pool!\n");
+        return NULL;
+    }
+
+    // Every slot must hold a free-list link and keep the next slot aligned
+    if (slotSize < sizeof(void*)) slotSize = sizeof(void*);
+    pool->slotSize = (slotSize + 15) & ~(size_t)15;
+    pool->slotsPerSlab = slotsPerSlab > 0 ? slotsPerSlab : 256;
+    pool->slabs = NULL;
+    pool->currentSlab = NULL;
+    pool->nextSlot = 0;
+    pool->freeList = NULL;
+    pool->slabCount = 0;
+    pool->slotsInUse = 0;
+    pool->peakSlotsInUse = 0;
+    pool->totalAllocations = 0;
+    return pool;
+}
+
+// Move to the next slab, allocating one if the chain is exhausted
+static int advanceSlab(MemoryPool* pool) {
+    if (pool->currentSlab != NULL && pool->currentSlab->next != NULL) {
+        pool->currentSlab = pool->currentSlab->next;
+        pool->nextSlot = 0;
+        return 1;
+    }
+
+    Slab* slab = (Slab*)malloc(SLAB_HEADER_SIZE + pool->slotSize * pool->slotsPerSlab);
+    if (slab == NULL) {
+        printf("❌ Memory allocation failed for pool slab!\n");
+        return 0;
+    }
+    slab->next = NULL;
+
+    if (pool->currentSlab == NULL) {
+        pool->slabs = slab;
+    } else {
+        pool->currentSlab->next = slab;
+    }
+    pool->currentSlab = slab;
+    pool->nextSlot = 0;
+    pool->slabCount++;
+    return 1;
+}
+
+// Allocate one slot (recycled slots first, then bump allocation)
+void* poolAlloc(MemoryPool* pool) {
+    if (pool == NULL) return NULL;
+
+    void* slot;
+    if (pool->freeList != NULL) {
+        slot = pool->freeList;
+        pool->freeList = *(void**)slot;
+    } else {
+        if (pool->currentSlab == NULL || pool->nextSlot >= pool->slotsPerSlab) {
+            if (pool->currentSlab == NULL && pool->slabs != NULL) {
+                // After a reset, start again from the first retained slab
+                pool->currentSlab = pool->slabs;
+                pool->nextSlot = 0;
+            } else if (!advanceSlab(pool)) {
+                return NULL;
+            }
+        }
+        slot = slabSlots(pool->currentSlab) + pool->slotSize * pool->nextSlot;
+        pool->nextSlot++;
+    }
+
+    pool->slotsInUse++;
+    pool->totalAllocations++;
+    if (pool->slotsInUse > pool->peakSlotsInUse) {
+        pool->peakSlotsInUse = pool->slotsInUse;
+    }
+    return slot;
+}
+
+// Return one slot to the pool's free list
+void poolFree(MemoryPool* pool, void* slot) {
+    if (pool == NULL || slot == NULL) return;
+
+    *(void**)slot = pool->freeList;
+    pool->freeList = slot;
+    pool->slotsInUse--;
+}
+
+// Release every slot at once; slabs are kept for the next run (O(1))
+void resetMemoryPool(MemoryPool* pool) {
+    if (pool == NULL) return;
+
+    pool->currentSlab = NULL;
+    pool->nextSlot = 0;
+    pool->freeList = NULL;
+    pool->slotsInUse = 0;
+}
+
+// Free all slabs and the pool itself
+void destroyMemoryPool(MemoryPool* pool) {
+    if (pool == NULL) return;
+
+    Slab* slab = pool->slabs;
+    while (slab != NULL) {
+        Slab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(pool);
+}
+
+// Snapshot of slab usage
+MemoryPoolStats getMemoryPoolStats(MemoryPool* pool) {
+    MemoryPoolStats stats;
+    memset(&stats, 0, sizeof(stats));
+    if (pool == NULL) return stats;
+
+    stats.slabCount = pool->slabCount;
+    stats.slotsPerSlab = pool->slotsPerSlab;
+    stats.slotSize = pool->slotSize;
+    stats.slotsInUse = pool->slotsInUse;
+    stats.peakSlotsInUse = pool->peakSlotsInUse;
+    stats.totalAllocations = pool->totalAllocations;
+    stats.bytesReserved = (SLAB_HEADER_SIZE + pool->slotSize * pool->slotsPerSlab) * pool->slabCount;
+
+    void* slot = pool->freeList;
+    while (slot != NULL) {
+        stats.freeListLength++;
+        slot = *(void**)slot;
+    }
+    return stats;
+}
+
+// Print slab usage
+void displayMemoryPoolStats(MemoryPool* pool, const char* poolName) {
+    if (pool == NULL) return;
+
+    MemoryPoolStats stats = getMemoryPoolStats(pool);
+    int capacity = stats.slabCount * stats.slotsPerSlab;
+    printf("  %s: %d/%d slots in use (peak %d) | %d slab(s) x %d slots x %d bytes | %d recycled | %.1f KB reserved\n",
+           poolName,
+           stats.slotsInUse, capacity, stats.peakSlotsInUse,
+           stats.slabCount, stats.slotsPerSlab, (int)stats.slotSize,
+           stats.freeListLength,
+           stats.bytesReserved / 1024.0);
+}
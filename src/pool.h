@@ -0,0 +1,51 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+
+// Fixed-size slot allocator backed by large slabs.
+// Slots are handed out by bumping through the current slab; freed slots go
+// on an intrusive free list and are reused first. All slots of a pool can be
+// released at once with resetMemoryPool (O(1), slabs are kept for reuse) or
+// destroyMemoryPool (frees the slabs themselves).
+typedef struct Slab {
+    struct Slab* next;
+} Slab;
+
+typedef struct MemoryPool {
+    size_t slotSize;
+    int slotsPerSlab;
+    Slab* slabs;          // All slabs, in allocation order
+    Slab* currentSlab;    // Slab being bump-allocated
+    int nextSlot;         // Next unused slot in currentSlab
+    void* freeList;       // Recycled slots
+    int slabCount;
+    int slotsInUse;
+    int peakSlotsInUse;
+    long totalAllocations;
+} MemoryPool;
+
+// Usage snapshot reported by getMemoryPoolStats
+typedef struct MemoryPoolStats {
+    int slabCount;
+    int slotsPerSlab;
+    size_t slotSize;
+    int slotsInUse;
+    int peakSlotsInUse;
+    int freeListLength;
+    long totalAllocations;
+    size_t bytesReserved;
+} MemoryPoolStats;
+
+// Pool operations
+MemoryPool* createMemoryPool(size_t slotSize, int slotsPerSlab);
+void* poolAlloc(MemoryPool* pool);
+void poolFree(MemoryPool* pool, void* slot);
+void resetMemoryPool(MemoryPool* pool);
+void destroyMemoryPool(MemoryPool* pool);
+
+// Statistics hook
+MemoryPoolStats getMemoryPoolStats(MemoryPool* pool);
+void displayMemoryPoolStats(MemoryPool* pool, const char* poolName);
+
+#endif
@@ -0,0 +1,84 @@
+#include "profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+// Drop every sample; the reset also anchors the tick calibration
+void resetPhaseProfile(PhaseProfile* profile) {
+    if (profile == NULL) return;
+    memset(profile->phases, 0, sizeof(profile->phases));
+    profile->startNs = monotonicNs();
+    profile->startTicks = profileTicks();
+}
+
+// Ticks per ns, measured against the monotonic clock since the profile began
+static double ticksPerNs(PhaseProfile* profile) {
+    double elapsedNs = monotonicNs() - profile->startNs;
+    while (elapsedNs < 1e6) {
+        elapsedNs = monotonicNs() - profile->startNs;    // A millisecond keeps the ratio accurate
+    }
+    double ratio = (double)(profileTicks() - profile->startTicks) / elapsedNs;
+    return ratio > 0 ? ratio : 1.0;
+}
+
+// Largest latency that falls in a bucket
+unsigned long long latencyBucketUpperBound(int bucket) {
+    if (bucket < LATENCY_SUB_BUCKETS) return (unsigned long long)bucket;
+    int exponent = bucket / LATENCY_SUB_BUCKETS + 2;
+    int step = bucket % LATENCY_SUB_BUCKETS;
+    unsigned long long lower = (unsigned long long)(LATENCY_SUB_BUCKETS + step) << (exponent - 3);
+    return lower + (1ULL << (exponent - 3)) - 1;
+}
+
+// Nearest-rank percentile in ticks (the bucket's upper bound, capped at the maximum)
+static unsigned long long histogramPercentile(LatencyHistogram* histogram, int percent) {
+    if (histogram->samples == 0) return 0;
+    unsigned long long rank = (histogram->samples * percent + 99) / 100;
+    unsigned long long seen = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        seen += histogram->counts[b];
+        if (seen >= rank) {
+            unsigned long long bound = latencyBucketUpperBound(b);
+            return bound < histogram->max ? bound : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+// p50/p99/max of one phase in ns
+PhaseSummary summarizePhase(PhaseProfile* profile, ProfilePhase phase) {
+    PhaseSummary summary = {0, 0, 0, 0};
+    if (profile == NULL || phase < 0 || phase >= PROFILE_PHASES) return summary;
+
+    LatencyHistogram* histogram = &profile->phases[phase];
+    summary.samples = histogram->samples;
+    if (histogram->samples == 0) return summary;
+
+    double ratio = ticksPerNs(profile);
+    summary.p50Ns = histogramPercentile(histogram, 50) / ratio;
+    summary.p99Ns = histogramPercentile(histogram, 99) / ratio;
+    summary.maxNs = histogram->max / ratio;
+    return summary;
+}
+
+const char* phaseToString(ProfilePhase phase) {
+    switch (phase) {
+        case PHASE_COMPLETION: return "completion";
+        case PHASE_SELECTION: return "selection";
+        case PHASE_ASSIGNMENT: return "assignment";
+        case PHASE_LOGGING: return "logging";
+        case PHASE_EXPORT: return "export";
+        default: return "unknown";
+    }
+}
+
+// Per-phase latency table
+void displayPhaseProfile(PhaseProfile* profile) {
+    if (profile == NULL) return;
+
+    printf("  %-10s | %10s | %10s | %10s | %10s\n", "phase", "samples", "p50 ns", "p99 ns", "max ns");
+    for (int p = 0; p < PROFILE_PHASES; p++) {
+        PhaseSummary summary = summarizePhase(profile, (ProfilePhase)p);
+        printf("  %-10s | %10llu | %10.0f | %10.0f | %10.0f\n", phaseToString((ProfilePhase)p),
+               summary.samples, summary.p50Ns, summary.p99Ns, summary.maxNs);
+    }
+}
@@ -0,0 +1,96 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Per-phase latency probes for the scheduler's hot path.
+// Built with -DENABLE_PROFILING (make -f Makefile.simple PROFILING=1), every
+// scheduler carries a PhaseProfile and the PROFILE_START / PROFILE_STOP probes
+// record each phase's latency in a log-linear histogram: 8 linear steps per
+// power of two, so any percentile is within 12.5% of the true value. Probes
+// read the CPU timestamp counter where there is one (a few ns per probe);
+// ticks are converted to ns only when a summary is asked for. Without
+// ENABLE_PROFILING the probes expand to nothing and schedulers carry no
+// profile.
+#include "virtual_clock.h"
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+typedef enum {
+    PHASE_COMPLETION = 0,     // Completing a flight whose runway time is up
+    PHASE_SELECTION = 1,      // Picking the next flight and a runway for it
+    PHASE_ASSIGNMENT = 2,     // Putting the flight on the runway
+    PHASE_LOGGING = 3,        // Per-flight console messages
+    PHASE_EXPORT = 4,         // exportAllDataJSON
+    PROFILE_PHASES = 5
+} ProfilePhase;
+
+#define LATENCY_SUB_BUCKETS 8
+#define LATENCY_BUCKETS 400     // Up to 2^51 ticks
+
+typedef struct LatencyHistogram {
+    unsigned long long counts[LATENCY_BUCKETS];
+    unsigned long long samples;
+    unsigned long long max;
+} LatencyHistogram;
+
+typedef struct PhaseProfile {
+    LatencyHistogram phases[PROFILE_PHASES];
+    unsigned long long startTicks;   // Calibration: ticks and ns when the profile began
+    double startNs;
+} PhaseProfile;
+
+typedef struct PhaseSummary {
+    unsigned long long samples;
+    double p50Ns;
+    double p99Ns;
+    double maxNs;
+} PhaseSummary;
+
+// Timestamp in profiler ticks (TSC cycles, or monotonic ns without a TSC)
+static inline unsigned long long profileTicks(void) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (unsigned long long)monotonicNs();
+#endif
+}
+
+// Histogram bucket of a latency: exact below 8, then 8 steps per power of two
+static inline int latencyBucket(unsigned long long ticks) {
+    if (ticks < LATENCY_SUB_BUCKETS) return (int)ticks;
+#if defined(_MSC_VER)
+    unsigned long top;
+    _BitScanReverse64(&top, ticks);
+    int exponent = (int)top;
+#else
+    int exponent = 63 - __builtin_clzll(ticks);
+#endif
+    int bucket = (exponent - 2) * LATENCY_SUB_BUCKETS + (int)((ticks >> (exponent - 3)) & (LATENCY_SUB_BUCKETS - 1));
+    return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+static inline void recordLatency(LatencyHistogram* histogram, unsigned long long ticks) {
+    histogram->counts[latencyBucket(ticks)]++;
+    histogram->samples++;
+    if (ticks > histogram->max) histogram->max = ticks;
+}
+
+#ifdef ENABLE_PROFILING
+#define PROFILE_START(probe) unsigned long long probe = profileTicks()
+#define PROFILE_STOP(profile, phase, probe) recordLatency(&(profile)->phases[phase], profileTicks() - (probe))
+#else
+#define PROFILE_START(probe) ((void)0)
+#define PROFILE_STOP(profile, phase, probe) ((void)0)
+#endif
+
+unsigned long long latencyBucketUpperBound(int bucket);
+void resetPhaseProfile(PhaseProfile* profile);
+PhaseSummary summarizePhase(PhaseProfile* profile, ProfilePhase phase);
+const char* phaseToString(ProfilePhase phase);
+void displayPhaseProfile(PhaseProfile* profile);
+
+#endif
@@ -9,71 +9,188 @@ Queue* createQueue() {
         printf("❌ Memory allocation failed for queue!\n");
         return NULL;
     }
-    q->front = NULL;
-    q->rear = NULL;
+    q->items = NULL;
+    q->head = 0;
+    q->used = 0;
+    q->capacity = 0;
     q->size = 0;
+    q->slotOf = NULL;
+    q->slotOfCapacity = 0;
+    
+    if (!reserveQueue(q, 16)) {
+        free(q);
+        return NULL;
+    }
     return q;
 }
 
+// Grow the flight -> slot map so it covers flight
+static int ensureQueueIndex(Queue* q, FlightIndex flight) {
+    if (flight < q->slotOfCapacity) return 1;
+    
+    int newCapacity = q->slotOfCapacity > 0 ? q->slotOfCapacity : 64;
+    while (newCapacity <= flight) newCapacity *= 2;
+    
+    int* slotOf = (int*)realloc(q->slotOf, sizeof(int) * newCapacity);
+    if (slotOf == NULL) {
+        printf("❌ Memory allocation failed for queue index!\n");
+        return 0;
+    }
+    for (int i = q->slotOfCapacity; i < newCapacity; i++) {
+        slotOf[i] = -1;
+    }
+    q->slotOf = slotOf;
+    q->slotOfCapacity = newCapacity;
+    return 1;
+}
+
+// Copy the live entries to the start of a buffer of newCapacity slots,
+// dropping removed entries on the way
+static int repackQueue(Queue* q, int newCapacity) {
+    FlightIndex* items = (FlightIndex*)malloc(sizeof(FlightIndex) * newCapacity);
+    if (items == NULL) {
+        printf("❌ Memory allocation failed for queue!\n");
+        return 0;
+    }
+    
+    int count = 0;
+    for (int i = 0; i < q->used; i++) {
+        FlightIndex flight = q->items[(q->head + i) & (q->capacity - 1)];
+        if (flight == NO_FLIGHT) continue;
+        items[count] = flight;
+        q->slotOf[flight] = count;
+        count++;
+    }
+    free(q->items);
+    q->items = items;
+    q->head = 0;
+    q->used = count;
+    q->capacity = newCapacity;
+    return 1;
+}
+
+// Make room for at least capacity queued flights
+int reserveQueue(Queue* q, int capacity) {
+    if (q == NULL) return 0;
+    if (capacity <= q->capacity) return 1;
+    
+    int newCapacity = q->capacity > 0 ? q->capacity : 16;
+    while (newCapacity < capacity) newCapacity *= 2;
+    return repackQueue(q, newCapacity);
+}
+
 // Check if queue is empty
 int isQueueEmpty(Queue* q) {
     if (q == NULL) return 1;
-    return q->front == NULL;
+    return q->size == 0;
 }
 
-// Enqueue operation
-void enqueue(Queue* q, Flight* flight) {
-    if (q == NULL || flight == NULL) {
+// Enqueue operation (no allocation unless the buffer is full)
+void enqueue(Queue* q, FlightIndex flight) {
+    if (q == NULL || flight == NO_FLIGHT || !ensureQueueIndex(q, flight)) {
         return;
     }
+    if (q->slotOf[flight] >= 0) {
+        return;    // Already queued
+    }
     
-    QueueNode* newNode = (QueueNode*)malloc(sizeof(QueueNode));
-    if (newNode == NULL) {
-        printf("❌ Memory allocation failed for queue node!\n");
-        return;
+    if (q->used == q->capacity) {
+        // Mostly holes left by removeFromQueue: compact in place, else grow
+        int newCapacity = q->size * 2 <= q->capacity ? q->capacity : q->capacity * 2;
+        if (!repackQueue(q, newCapacity)) return;
     }
     
-    newNode->flight = flight;
-    newNode->next = NULL;
+    int slot = (q->head + q->used) & (q->capacity - 1);
+    q->items[slot] = flight;
+    q->slotOf[flight] = slot;
+    q->used++;
+    q->size++;
+}
+
+// Put a flight back at the front (e.g. a takeoff bumped off its runway)
+void enqueueFront(Queue* q, FlightIndex flight) {
+    if (q == NULL || flight == NO_FLIGHT || !ensureQueueIndex(q, flight)) {
+        return;
+    }
+    if (q->slotOf[flight] >= 0) {
+        return;    // Already queued
+    }
     
-    if (q->rear == NULL) {
-        q->front = q->rear = newNode;
-    } else {
-        q->rear->next = newNode;
-        q->rear = newNode;
+    if (q->used == q->capacity) {
+        int newCapacity = q->size * 2 <= q->capacity ? q->capacity : q->capacity * 2;
+        if (!repackQueue(q, newCapacity)) return;
     }
+    
+    q->head = (q->head - 1) & (q->capacity - 1);
+    q->items[q->head] = flight;
+    q->slotOf[flight] = q->head;
+    q->used++;
     q->size++;
 }
 
+// Skip removed entries at the front
+static void trimQueueFront(Queue* q) {
+    while (q->used > 0 && q->items[q->head] == NO_FLIGHT) {
+        q->head = (q->head + 1) & (q->capacity - 1);
+        q->used--;
+    }
+}
+
 // Dequeue operation
-Flight* dequeue(Queue* q) {
+FlightIndex dequeue(Queue* q) {
     if (q == NULL || isQueueEmpty(q)) {
-        return NULL;
-    }
-    
-    QueueNode* temp = q->front;
-    Flight* flight = temp->flight;
-    q->front = q->front->next;
-    
-    if (q->front == NULL) {
-        q->rear = NULL;
+        return NO_FLIGHT;
     }
     
-    free(temp);
+    trimQueueFront(q);
+    FlightIndex flight = q->items[q->head];
+    q->head = (q->head + 1) & (q->capacity - 1);
+    q->used--;
     q->size--;
+    q->slotOf[flight] = -1;
     return flight;
 }
 
 // Peek operation
-Flight* peek(Queue* q) {
+FlightIndex peek(Queue* q) {
     if (q == NULL || isQueueEmpty(q)) {
-        return NULL;
+        return NO_FLIGHT;
     }
-    return q->front->flight;
+    trimQueueFront(q);
+    return q->items[q->head];
+}
+
+// Flight at position i from the front, counting removed entries
+// (NO_FLIGHT for those); valid for 0 <= i < q->used
+FlightIndex queueAt(Queue* q, int i) {
+    if (q == NULL || i < 0 || i >= q->used) return NO_FLIGHT;
+    return q->items[(q->head + i) & (q->capacity - 1)];
+}
+
+// Check whether a flight is waiting in the queue (O(1))
+int queueContains(Queue* q, FlightIndex flight) {
+    if (q == NULL || flight < 0 || flight >= q->slotOfCapacity) return 0;
+    return q->slotOf[flight] >= 0;
+}
+
+// Remove a flight from anywhere in the queue (O(1), leaves a hole)
+int removeFromQueue(Queue* q, FlightIndex flight) {
+    if (!queueContains(q, flight)) return 0;
+    
+    q->items[q->slotOf[flight]] = NO_FLIGHT;
+    q->slotOf[flight] = -1;
+    q->size--;
+    
+    // Drop holes at either end right away
+    trimQueueFront(q);
+    while (q->used > 0 && q->items[(q->head + q->used - 1) & (q->capacity - 1)] == NO_FLIGHT) {
+        q->used--;
+    }
+    return 1;
 }
 
 // Display queue contents
-void displayQueue(Queue* q, const char* queueName) {
+void displayQueue(Queue* q, FlightTable* table, const char* queueName) {
     if (q == NULL || isQueueEmpty(q)) {
         printf("\n📭 %s is empty.\n", queueName);
         return;
@@ -84,19 +201,20 @@ void displayQueue(Queue* q, const char* queueName) {
     printf("╚═══════════════════════════════════════════════════════════════╝\n");
     printf("Queue Size: %d\n", q->size);
     
-    QueueNode* temp = q->front;
     int pos = 1;
-    while (temp != NULL) {
+    for (int i = 0; i < q->used; i++) {
+        FlightIndex index = queueAt(q, i);
+        if (index == NO_FLIGHT) continue;
+        Flight* flight = getFlightRecord(table, index);
         char timeStr[10];
-        timeToString(temp->flight->scheduledTime, timeStr);
+        timeToString(flight->scheduledTime, timeStr);
         printf("%d. %s | %s | %s | Priority: %s | Time: %s\n", 
                pos++,
-               temp->flight->flightID,
-               temp->flight->airline,
-               operationToString(temp->flight->operation),
-               priorityToString(temp->flight->priority),
+               flight->flightID,
+               symbolToString(flight->airline),
+               operationToString(flight->operation),
+               priorityToString(flight->priority),
                timeStr);
-        temp = temp->next;
     }
 }
 
@@ -104,112 +222,294 @@ void displayQueue(Queue* q, const char* queueName) {
 void freeQueue(Queue* q) {
     if (q == NULL) return;
     
-    while (!isQueueEmpty(q)) {
-        dequeue(q);
-    }
+    free(q->items);
+    free(q->slotOf);
     free(q);
 }
 
 // ==================== PRIORITY QUEUE OPERATIONS (MIN-HEAP) ====================
 
-// Create priority queue
-PriorityQueue* createPriorityQueue() {
+// Create priority queue ordering flights of the given table
+PriorityQueue* createPriorityQueue(FlightTable* table) {
+    return createPriorityQueueWithArity(table, DEFAULT_HEAP_ARITY);
+}
+
+// Create priority queue with a d-ary fan-out of 2, 4 or 8
+PriorityQueue* createPriorityQueueWithArity(FlightTable* table, int arity) {
     PriorityQueue* pq = (PriorityQueue*)malloc(sizeof(PriorityQueue));
     if (pq == NULL) {
         printf("❌ Memory allocation failed for priority queue!\n");
         return NULL;
     }
+    pq->kind = HEAP_QUEUE;
+    pq->buckets = NULL;
+    pq->entries = NULL;
     pq->size = 0;
+    pq->capacity = 0;
+    pq->arity = (arity == 2 || arity == 4 || arity == 8) ? arity : DEFAULT_HEAP_ARITY;
+    pq->table = table;
+    pq->position = NULL;
+    pq->positionCapacity = 0;
+    pq->nextSequence = 0;
+    pq->order = ORDER_BY_PRIORITY;
+    pq->agingRate = 0;
+    
+    if (!reservePriorityQueue(pq, 16)) {
+        free(pq);
+        return NULL;
+    }
+    return pq;
+}
+
+// Create priority queue backed by a bucket queue (O(1) insert/extract)
+PriorityQueue* createBucketPriorityQueue(FlightTable* table) {
+    PriorityQueue* pq = createPriorityQueue(table);
+    if (pq == NULL) return NULL;
+    
+    pq->buckets = createBucketQueue(table);
+    if (pq->buckets == NULL) {
+        freePriorityQueue(pq);
+        return NULL;
+    }
+    pq->kind = BUCKET_QUEUE;
     return pq;
 }
 
+// Create a heap serving the shortest processing time first (ties in arrival
+// order); agingRate > 0 lets flights that have waited long enough overtake
+PriorityQueue* createShortestJobQueue(FlightTable* table, int arity, int agingRate) {
+    PriorityQueue* pq = createPriorityQueueWithArity(table, arity);
+    if (pq == NULL) return NULL;
+    
+    pq->order = ORDER_BY_SHORTEST_JOB;
+    pq->agingRate = agingRate > 0 ? agingRate : 0;
+    return pq;
+}
+
+// Make room for at least capacity flights (one allocation for bulk loads)
+int reservePriorityQueue(PriorityQueue* pq, int capacity) {
+    if (pq == NULL) return 0;
+    if (capacity <= pq->capacity) return 1;
+    
+    HeapEntry* entries = (HeapEntry*)realloc(pq->entries, sizeof(HeapEntry) * capacity);
+    if (entries == NULL) {
+        printf("❌ Memory allocation failed for priority queue!\n");
+        return 0;
+    }
+    pq->entries = entries;
+    pq->capacity = capacity;
+    return 1;
+}
+
+// Grow the flight -> heap slot map so it covers flight
+static int ensureHeapIndex(PriorityQueue* pq, FlightIndex flight) {
+    if (flight < pq->positionCapacity) return 1;
+    
+    int newCapacity = pq->positionCapacity > 0 ? pq->positionCapacity : 64;
+    while (newCapacity <= flight) newCapacity *= 2;
+    
+    int* position = (int*)realloc(pq->position, sizeof(int) * newCapacity);
+    if (position == NULL) {
+        printf("❌ Memory allocation failed for priority queue index!\n");
+        return 0;
+    }
+    for (int i = pq->positionCapacity; i < newCapacity; i++) {
+        position[i] = -1;
+    }
+    pq->position = position;
+    pq->positionCapacity = newCapacity;
+    return 1;
+}
+
 // Check if priority queue is empty
 int isPriorityQueueEmpty(PriorityQueue* pq) {
     if (pq == NULL) return 1;
     return pq->size == 0;
 }
 
-// Compare two flights (returns negative if f1 has higher priority than f2)
+// Pack the ordering fields into one key: a smaller key is served first.
+// Bits 61-63: 7 - emergency type  (higher emergency first)
+// Bits 58-60: 7 - priority        (higher priority first)
+// Bits 32-57: scheduled time + KEY_TIME_BIAS (earlier first)
+// Bits  0-31: insertion sequence  (equal flights leave in arrival order)
+PriorityKey makePriorityKey(int emergencyType, int priority, int scheduledTime, unsigned int sequence) {
+    unsigned long long time = (unsigned long long)(scheduledTime + KEY_TIME_BIAS) & KEY_TIME_MASK;
+    return ((unsigned long long)(7 - (emergencyType & 7)) << 61) |
+           ((unsigned long long)(7 - (priority & 7)) << 58) |
+           (time << 32) |
+           (unsigned long long)sequence;
+}
+
+// Key of a table row (sequence 0)
+PriorityKey flightPriorityKey(FlightTable* table, FlightIndex flight) {
+    return makePriorityKey(table->emergencyType[flight], table->priority[flight],
+                           table->scheduledTime[flight], 0);
+}
+
+// Shortest-job key: a smaller key is served first.
+// Bits 32-63: processing time * SJF_AGING_SCALE + agingRate * scheduled time
+// Bits  0-31: insertion sequence
+// Aging lowers a flight's effective job length by agingRate / SJF_AGING_SCALE
+// per minute waited. At any instant that ranks flights the same way as the
+// static value above, so keys never need to be refreshed as time passes.
+PriorityKey makeShortestJobKey(int processingTime, int scheduledTime, int agingRate, unsigned int sequence) {
+    long long cost = (long long)processingTime * SJF_AGING_SCALE +
+                     (long long)agingRate * scheduledTime + 0x80000000LL;
+    if (cost < 0) cost = 0;
+    if (cost > 0xFFFFFFFFLL) cost = 0xFFFFFFFFLL;
+    return ((unsigned long long)cost << 32) | (unsigned long long)sequence;
+}
+
+// Key of a queued flight under the heap's ordering
+static PriorityKey heapEntryKey(PriorityQueue* pq, FlightIndex flight, unsigned int sequence) {
+    if (pq->order == ORDER_BY_SHORTEST_JOB) {
+        return makeShortestJobKey(pq->table->processingTime[flight], pq->table->scheduledTime[flight],
+                                  pq->agingRate, sequence);
+    }
+    return makePriorityKey(pq->table->emergencyType[flight], pq->table->priority[flight],
+                           pq->table->scheduledTime[flight], sequence);
+}
+
+// Compare flights for priority (branchless, on packed keys)
+// Returns negative if f1 has higher priority, positive if f2 has higher priority
 int compareFlight(Flight* f1, Flight* f2) {
     if (f1 == NULL || f2 == NULL) return 0;
     
-    // First, compare emergency types (INFLIGHT_EMERGENCY=4 > AIRPLANE_DEFECT=3 > PILOT_UNAVAILABLE=2 > AIRPORT_DELAY=1)
-    if (f1->emergencyType != f2->emergencyType) {
-        return f2->emergencyType - f1->emergencyType; // Higher emergency type comes first
-    }
-    
-    // Then, compare flight priority (EMERGENCY=3 > VIP=2 > SCHEDULED=1)
-    if (f1->priority != f2->priority) {
-        return f2->priority - f1->priority; // Higher priority comes first (min-heap for max priority)
-    }
-    
-    // If same priority and emergency type, compare scheduled time (earlier time first)
-    return f1->scheduledTime - f2->scheduledTime;
+    // Emergency type, then priority level, then earlier scheduled time
+    PriorityKey a = makePriorityKey(f1->emergencyType, f1->priority, f1->scheduledTime, 0);
+    PriorityKey b = makePriorityKey(f2->emergencyType, f2->priority, f2->scheduledTime, 0);
+    return (a > b) - (a < b);
+}
+
+// Same ordering as compareFlight, reading only the table's hot columns
+int compareFlightIndex(FlightTable* table, FlightIndex a, FlightIndex b) {
+    PriorityKey ka = flightPriorityKey(table, a);
+    PriorityKey kb = flightPriorityKey(table, b);
+    return (ka > kb) - (ka < kb);
 }
 
-// Heapify up (for insertion)
+// Heapify up (for insertion): move the hole up instead of swapping
 void heapifyUp(PriorityQueue* pq, int index) {
-    if (pq == NULL || index == 0) return;
+    if (pq == NULL) return;
     
-    int parent = (index - 1) / 2;
-    if (compareFlight(pq->flights[index], pq->flights[parent]) < 0) {
-        // Swap
-        Flight* temp = pq->flights[index];
-        pq->flights[index] = pq->flights[parent];
-        pq->flights[parent] = temp;
-        heapifyUp(pq, parent);
+    HeapEntry entry = pq->entries[index];
+    while (index > 0) {
+        int parent = (index - 1) / pq->arity;
+        if (entry.key >= pq->entries[parent].key) break;
+        pq->entries[index] = pq->entries[parent];
+        pq->position[pq->entries[index].flight] = index;
+        index = parent;
     }
+    pq->entries[index] = entry;
+    pq->position[entry.flight] = index;
 }
 
-// Heapify down (for extraction)
+// Heapify down (for extraction): pick the best of up to arity children
 void heapifyDown(PriorityQueue* pq, int index) {
     if (pq == NULL) return;
     
-    int smallest = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
-    
-    if (left < pq->size && compareFlight(pq->flights[left], pq->flights[smallest]) < 0) {
-        smallest = left;
-    }
-    
-    if (right < pq->size && compareFlight(pq->flights[right], pq->flights[smallest]) < 0) {
-        smallest = right;
-    }
-    
-    if (smallest != index) {
-        // Swap
-        Flight* temp = pq->flights[index];
-        pq->flights[index] = pq->flights[smallest];
-        pq->flights[smallest] = temp;
-        heapifyDown(pq, smallest);
+    HeapEntry entry = pq->entries[index];
+    while (1) {
+        int first = pq->arity * index + 1;
+        if (first >= pq->size) break;
+        
+        int last = first + pq->arity;
+        if (last > pq->size) last = pq->size;
+        
+        int smallest = first;
+        for (int child = first + 1; child < last; child++) {
+            if (pq->entries[child].key < pq->entries[smallest].key) {
+                smallest = child;
+            }
+        }
+        if (pq->entries[smallest].key >= entry.key) break;
+        
+        pq->entries[index] = pq->entries[smallest];
+        pq->position[pq->entries[index].flight] = index;
+        index = smallest;
     }
+    pq->entries[index] = entry;
+    pq->position[entry.flight] = index;
 }
 
-// Insert into priority queue
-void insertPriorityQueue(PriorityQueue* pq, Flight* flight) {
-    if (pq == NULL || flight == NULL) {
+// Insert into priority queue (capacity doubles when full)
+void insertPriorityQueue(PriorityQueue* pq, FlightIndex flight) {
+    if (pq == NULL || flight == NO_FLIGHT || !ensureHeapIndex(pq, flight)) {
         return;
     }
+    if (pq->kind == BUCKET_QUEUE) {
+        bucketQueueInsert(pq->buckets, flight);
+        pq->size = pq->buckets->size;
+        return;
+    }
+    if (pq->position[flight] >= 0) {
+        return;    // Already queued
+    }
     
-    if (pq->size >= 100) {
-        printf("❌ Priority queue is full!\n");
+    if (pq->size == pq->capacity && !reservePriorityQueue(pq, pq->capacity * 2)) {
         return;
     }
     
-    pq->flights[pq->size] = flight;
+    HeapEntry* entry = &pq->entries[pq->size];
+    entry->flight = flight;
+    entry->key = heapEntryKey(pq, flight, pq->nextSequence++);
     heapifyUp(pq, pq->size);
     pq->size++;
 }
 
+// Insert many flights at once: append them, then restore heap order with
+// Floyd's bottom-up heapify (O(n) instead of O(n log n))
+void insertPriorityQueueBulk(PriorityQueue* pq, const FlightIndex* flights, int count) {
+    if (pq == NULL || flights == NULL || count <= 0) return;
+    
+    // Few flights into a big heap: sifting each one up is cheaper
+    if (pq->kind == BUCKET_QUEUE || count < pq->size) {
+        for (int i = 0; i < count; i++) {
+            insertPriorityQueue(pq, flights[i]);
+        }
+        return;
+    }
+    
+    int capacity = pq->capacity;
+    while (capacity < pq->size + count) capacity *= 2;
+    if (!reservePriorityQueue(pq, capacity)) return;
+    
+    for (int i = 0; i < count; i++) {
+        FlightIndex flight = flights[i];
+        if (flight == NO_FLIGHT || !ensureHeapIndex(pq, flight) || pq->position[flight] >= 0) {
+            continue;
+        }
+        HeapEntry* entry = &pq->entries[pq->size];
+        entry->flight = flight;
+        entry->key = heapEntryKey(pq, flight, pq->nextSequence++);
+        pq->position[flight] = pq->size;
+        pq->size++;
+    }
+    
+    // (size - 2) / arity rounds to 0 for size 0 with arity > 2: an empty
+    // heap must not be sifted, entries[0] may hold a flight already removed
+    if (pq->size > 1) {
+        for (int i = (pq->size - 2) / pq->arity; i >= 0; i--) {
+            heapifyDown(pq, i);
+        }
+    }
+}
+
 // Extract minimum (highest priority) from priority queue
-Flight* extractMin(PriorityQueue* pq) {
+FlightIndex extractMin(PriorityQueue* pq) {
     if (pq == NULL || isPriorityQueueEmpty(pq)) {
-        return NULL;
+        return NO_FLIGHT;
+    }
+    
+    if (pq->kind == BUCKET_QUEUE) {
+        FlightIndex flight = bucketQueueExtractMin(pq->buckets);
+        pq->size = pq->buckets->size;
+        return flight;
     }
     
-    Flight* minFlight = pq->flights[0];
-    pq->flights[0] = pq->flights[pq->size - 1];
+    FlightIndex minFlight = pq->entries[0].flight;
+    pq->position[minFlight] = -1;
+    pq->entries[0] = pq->entries[pq->size - 1];
     pq->size--;
     
     if (pq->size > 0) {
@@ -219,12 +519,66 @@ Flight* extractMin(PriorityQueue* pq) {
     return minFlight;
 }
 
+// Check whether a flight is in the heap (O(1))
+int priorityQueueContains(PriorityQueue* pq, FlightIndex flight) {
+    if (pq == NULL) return 0;
+    if (pq->kind == BUCKET_QUEUE) return bucketQueueContains(pq->buckets, flight);
+    if (flight < 0 || flight >= pq->positionCapacity) return 0;
+    return pq->position[flight] >= 0;
+}
+
+// Remove a flight from anywhere in the heap (O(log n))
+int removeFromPriorityQueue(PriorityQueue* pq, FlightIndex flight) {
+    if (!priorityQueueContains(pq, flight)) return 0;
+    if (pq->kind == BUCKET_QUEUE) {
+        bucketQueueRemove(pq->buckets, flight);
+        pq->size = pq->buckets->size;
+        return 1;
+    }
+    
+    int slot = pq->position[flight];
+    pq->position[flight] = -1;
+    pq->size--;
+    
+    // Fill the hole with the last entry and restore heap order around it
+    if (slot < pq->size) {
+        FlightIndex last = pq->entries[pq->size].flight;
+        pq->entries[slot] = pq->entries[pq->size];
+        pq->position[last] = slot;
+        heapifyUp(pq, slot);
+        heapifyDown(pq, pq->position[last]);
+    }
+    return 1;
+}
+
+// Recompute a flight's key after its priority fields changed (O(log n))
+void updatePriorityQueue(PriorityQueue* pq, FlightIndex flight) {
+    if (!priorityQueueContains(pq, flight)) return;
+    if (pq->kind == BUCKET_QUEUE) {
+        bucketQueueUpdate(pq->buckets, flight);
+        return;
+    }
+    
+    HeapEntry* entry = &pq->entries[pq->position[flight]];
+    entry->key = heapEntryKey(pq, flight, (unsigned int)entry->key);
+    heapifyUp(pq, pq->position[flight]);
+    heapifyDown(pq, pq->position[flight]);
+}
+
 // Peek minimum
-Flight* peekMin(PriorityQueue* pq) {
+FlightIndex peekMin(PriorityQueue* pq) {
     if (pq == NULL || isPriorityQueueEmpty(pq)) {
-        return NULL;
+        return NO_FLIGHT;
     }
-    return pq->flights[0];
+    if (pq->kind == BUCKET_QUEUE) return bucketQueuePeekMin(pq->buckets);
+    return pq->entries[0].flight;
+}
+
+// Flight at position i (0 <= i < size) in storage order, for iteration
+FlightIndex priorityQueueAt(PriorityQueue* pq, int i) {
+    if (pq == NULL || i < 0 || i >= pq->size) return NO_FLIGHT;
+    if (pq->kind == BUCKET_QUEUE) return pq->buckets->members[i];
+    return pq->entries[i].flight;
 }
 
 // Display priority queue
@@ -240,15 +594,16 @@ void displayPriorityQueue(PriorityQueue* pq, const char* queueName) {
     printf("Queue Size: %d\n", pq->size);
     
     for (int i = 0; i < pq->size; i++) {
-        if (pq->flights[i] != NULL) {
+        Flight* flight = getFlightRecord(pq->table, priorityQueueAt(pq, i));
+        if (flight != NULL) {
             char timeStr[10];
-            timeToString(pq->flights[i]->scheduledTime, timeStr);
+            timeToString(flight->scheduledTime, timeStr);
             printf("%d. %s | %s | %s | Priority: %s | Time: %s\n", 
                    i+1,
-                   pq->flights[i]->flightID,
-                   pq->flights[i]->airline,
-                   operationToString(pq->flights[i]->operation),
-                   priorityToString(pq->flights[i]->priority),
+                   flight->flightID,
+                   symbolToString(flight->airline),
+                   operationToString(flight->operation),
+                   priorityToString(flight->priority),
                    timeStr);
         }
     }
@@ -257,6 +612,9 @@ void displayPriorityQueue(PriorityQueue* pq, const char* queueName) {
 // Free priority queue
 void freePriorityQueue(PriorityQueue* pq) {
     if (pq != NULL) {
+        free(pq->entries);
+        freeBucketQueue(pq->buckets);
+        free(pq->position);
         free(pq);
     }
 }
\ No newline at end of file
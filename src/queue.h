@@ -1,46 +1,105 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-#include "flight.h"
+#include "flight_table.h"
+#include "bucket_queue.h"
 
-// Queue node for regular queue
-typedef struct QueueNode {
-    Flight* flight;
-    struct QueueNode* next;
-} QueueNode;
-
-// Queue structure
+// Queue structure: growable circular buffer of flight handles.
+// Steady-state enqueue/dequeue never allocate. removeFromQueue leaves a
+// NO_FLIGHT hole that is skipped on dequeue and dropped on the next repack.
 typedef struct Queue {
-    QueueNode* front;
-    QueueNode* rear;
-    int size;
+    FlightIndex* items;       // Ring buffer, capacity is a power of two
+    int head;                 // Slot of the front entry
+    int used;                 // Entries from head, holes included
+    int capacity;
+    int size;                 // Flights actually queued
+    int* slotOf;              // Flight index -> ring slot (-1 if absent)
+    int slotOfCapacity;
 } Queue;
 
-// Priority Queue node (for min-heap implementation)
+// Default heap fan-out (see the heap benchmark in benchmark.c)
+#define DEFAULT_HEAP_ARITY 4
+
+// Packed ordering key (see makePriorityKey); smaller keys are served first
+typedef unsigned long long PriorityKey;
+#define KEY_TIME_BIAS (1 << 25)         // Lets slightly negative times sort first
+#define KEY_TIME_MASK 0x3FFFFFFULL      // 26 bits of scheduled time
+
+// Heap entry: the key sits next to the flight handle, so sifting compares
+// plain integers without touching the flight table
+typedef struct HeapEntry {
+    PriorityKey key;
+    FlightIndex flight;
+} HeapEntry;
+
+// Priority queue backends
+typedef enum {
+    HEAP_QUEUE = 0,       // d-ary heap on packed keys (any key range)
+    BUCKET_QUEUE = 1      // Bucket queue on (emergency, priority, minute)
+} PriorityQueueKind;
+
+// What a heap's keys are built from
+typedef enum {
+    ORDER_BY_PRIORITY = 0,      // makePriorityKey: emergency, priority, scheduled time
+    ORDER_BY_SHORTEST_JOB = 1   // makeShortestJobKey: processing time with optional aging
+} PriorityOrder;
+
+// Aging rates are in 1/SJF_AGING_SCALE minutes of processing per minute of waiting
+#define SJF_AGING_SCALE 16
+
+// Priority Queue (d-ary min-heap, grows geometrically, or a bucket queue)
 typedef struct {
-    Flight* flights[100]; // Max 100 flights in priority queue
+    PriorityQueueKind kind;
+    BucketQueue* buckets;     // Only for BUCKET_QUEUE
+    HeapEntry* entries;
     int size;
+    int capacity;
+    int arity;                // Children per node: 2, 4 or 8
+    FlightTable* table;       // Hot fields the keys are built from
+    int* position;            // Flight index -> heap slot (-1 if absent)
+    int positionCapacity;
+    unsigned int nextSequence;  // Insertion counter for stable ties
+    PriorityOrder order;      // Key layout (bucket queues always order by priority)
+    int agingRate;            // ORDER_BY_SHORTEST_JOB only, see makeShortestJobKey
 } PriorityQueue;
 
 // Regular Queue operations
 Queue* createQueue();
+int reserveQueue(Queue* q, int capacity);
 int isQueueEmpty(Queue* q);
-void enqueue(Queue* q, Flight* flight);
-Flight* dequeue(Queue* q);
-Flight* peek(Queue* q);
-void displayQueue(Queue* q, const char* queueName);
+void enqueue(Queue* q, FlightIndex flight);
+void enqueueFront(Queue* q, FlightIndex flight);
+FlightIndex dequeue(Queue* q);
+FlightIndex peek(Queue* q);
+FlightIndex queueAt(Queue* q, int i);
+int queueContains(Queue* q, FlightIndex flight);
+int removeFromQueue(Queue* q, FlightIndex flight);
+void displayQueue(Queue* q, FlightTable* table, const char* queueName);
 void freeQueue(Queue* q);
 
 // Priority Queue operations (Min-Heap)
-PriorityQueue* createPriorityQueue();
+PriorityQueue* createPriorityQueue(FlightTable* table);
+PriorityQueue* createPriorityQueueWithArity(FlightTable* table, int arity);
+PriorityQueue* createBucketPriorityQueue(FlightTable* table);
+PriorityQueue* createShortestJobQueue(FlightTable* table, int arity, int agingRate);
+int reservePriorityQueue(PriorityQueue* pq, int capacity);
 int isPriorityQueueEmpty(PriorityQueue* pq);
-void insertPriorityQueue(PriorityQueue* pq, Flight* flight);
-Flight* extractMin(PriorityQueue* pq);
-Flight* peekMin(PriorityQueue* pq);
+void insertPriorityQueue(PriorityQueue* pq, FlightIndex flight);
+void insertPriorityQueueBulk(PriorityQueue* pq, const FlightIndex* flights, int count);
+FlightIndex extractMin(PriorityQueue* pq);
+FlightIndex peekMin(PriorityQueue* pq);
+FlightIndex priorityQueueAt(PriorityQueue* pq, int i);
+int priorityQueueContains(PriorityQueue* pq, FlightIndex flight);
+int removeFromPriorityQueue(PriorityQueue* pq, FlightIndex flight);
+void updatePriorityQueue(PriorityQueue* pq, FlightIndex flight);
 void displayPriorityQueue(PriorityQueue* pq, const char* queueName);
 void heapifyUp(PriorityQueue* pq, int index);
 void heapifyDown(PriorityQueue* pq, int index);
+PriorityKey makePriorityKey(int emergencyType, int priority, int scheduledTime, unsigned int sequence);
+PriorityKey flightPriorityKey(FlightTable* table, FlightIndex flight);
+PriorityKey makeShortestJobKey(int processingTime, int scheduledTime, int agingRate, unsigned int sequence);
 int compareFlight(Flight* f1, Flight* f2);
+int compareFlightIndex(FlightTable* table, FlightIndex a, FlightIndex b);
 void freePriorityQueue(PriorityQueue* pq);
 
 #endif
@@ -0,0 +1,212 @@
+#include "registry.h"
+
+#define REGISTRY_INITIAL_CAPACITY 64
+#define FLIGHTS_PER_SLAB 256
+
+// FNV-1a hash of a flight ID
+static unsigned int hashFlightID(const char* id) {
+    unsigned int hash = 2166136261u;
+    while (*id) {
+        hash ^= (unsigned char)*id++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Find the slot holding id, or the empty slot where it would go
+static int probeSlot(FlightRegistry* registry, const char* id, unsigned int hash) {
+    int mask = registry->capacity - 1;
+    int i = (int)(hash & (unsigned int)mask);
+
+    while (registry->slots[i].flight != NULL) {
+        if (registry->slots[i].hash == hash &&
+            strcmp(registry->slots[i].flight->flightID, id) == 0) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+// Resize the hash index to newCapacity slots and reinsert every flight
+static int growIndex(FlightRegistry* registry, int newCapacity) {
+    RegistrySlot* newSlots = (RegistrySlot*)calloc(newCapacity, sizeof(RegistrySlot));
+    if (newSlots == NULL) {
+        printf("❌ Memory allocation failed for registry index!\n");
+        return 0;
+    }
+
+    int mask = newCapacity - 1;
+    for (int i = 0; i < registry->capacity; i++) {
+        if (registry->slots[i].flight == NULL) continue;
+        int j = (int)(registry->slots[i].hash & (unsigned int)mask);
+        while (newSlots[j].flight != NULL) {
+            j = (j + 1) & mask;
+        }
+        newSlots[j] = registry->slots[i];
+    }
+
+    free(registry->slots);
+    registry->slots = newSlots;
+    registry->capacity = newCapacity;
+    return 1;
+}
+
+// Create an empty registry
+FlightRegistry* createFlightRegistry() {
+    FlightRegistry* registry = (FlightRegistry*)malloc(sizeof(FlightRegistry));
+    if (registry == NULL) {
+        printf("❌ Memory allocation failed for flight registry!\n");
+        return NULL;
+    }
+
+    registry->slots = (RegistrySlot*)calloc(REGISTRY_INITIAL_CAPACITY, sizeof(RegistrySlot));
+    registry->flightPool = createMemoryPool(sizeof(Flight), FLIGHTS_PER_SLAB);
+    if (registry->slots == NULL || registry->flightPool == NULL) {
+        printf("❌ Memory allocation failed for registry index!\n");
+        free(registry->slots);
+        destroyMemoryPool(registry->flightPool);
+        free(registry);
+        return NULL;
+    }
+    registry->capacity = REGISTRY_INITIAL_CAPACITY;
+    registry->head = NULL;
+    registry->tail = NULL;
+    registry->count = 0;
+    return registry;
+}
+
+// Append a flight and index it by ID (returns 1 on success, 0 if rejected)
+int addFlightToRegistry(FlightRegistry* registry, Flight* flight) {
+    if (registry == NULL || flight == NULL) return 0;
+
+    // Keep load factor at or below 1/2 so probe chains stay short
+    if ((registry->count + 1) * 2 > registry->capacity &&
+        !growIndex(registry, registry->capacity * 2)) {
+        return 0;
+    }
+
+    unsigned int hash = hashFlightID(flight->flightID);
+    int slot = probeSlot(registry, flight->flightID, hash);
+    if (registry->slots[slot].flight != NULL) {
+        printf("❌ Flight %s already exists!\n", flight->flightID);
+        return 0;
+    }
+    registry->slots[slot].hash = hash;
+    registry->slots[slot].flight = flight;
+
+    // O(1) append using the tail pointer
+    flight->next = NULL;
+    flight->prev = registry->tail;
+    if (registry->tail == NULL) {
+        registry->head = flight;
+    } else {
+        registry->tail->next = flight;
+    }
+    registry->tail = flight;
+    registry->count++;
+    return 1;
+}
+
+// Append many flights in one pass, sizing the index once up front.
+// Accepted flights are moved to the front of the array (in order) and
+// duplicates behind them; returns the number accepted.
+int addFlightsToRegistryBulk(FlightRegistry* registry, Flight** flights, int count) {
+    if (registry == NULL || flights == NULL || count <= 0) return 0;
+
+    int capacity = registry->capacity;
+    while ((registry->count + count) * 2 > capacity) {
+        capacity *= 2;
+    }
+    if (capacity != registry->capacity && !growIndex(registry, capacity)) {
+        return 0;
+    }
+
+    int accepted = 0;
+    for (int i = 0; i < count; i++) {
+        if (addFlightToRegistry(registry, flights[i])) {
+            Flight* flight = flights[i];
+            flights[i] = flights[accepted];
+            flights[accepted++] = flight;
+        }
+    }
+    return accepted;
+}
+
+// Find flight by ID using the hash index
+Flight* findFlightInRegistry(FlightRegistry* registry, const char* id) {
+    if (registry == NULL || id == NULL) return NULL;
+
+    int slot = probeSlot(registry, id, hashFlightID(id));
+    return registry->slots[slot].flight;
+}
+
+// Delete flight by ID (returns 1 if a flight was deleted)
+int deleteFlightFromRegistry(FlightRegistry* registry, const char* id) {
+    if (registry == NULL || id == NULL) return 0;
+
+    if (registry->count == 0) {
+        printf("❌ Flight list is empty!\n");
+        return 0;
+    }
+
+    int i = probeSlot(registry, id, hashFlightID(id));
+    Flight* flight = registry->slots[i].flight;
+    if (flight == NULL) {
+        printf("❌ Flight %s not found!\n", id);
+        return 0;
+    }
+
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    int mask = registry->capacity - 1;
+    int j = i;
+    while (1) {
+        j = (j + 1) & mask;
+        if (registry->slots[j].flight == NULL) break;
+        int home = (int)(registry->slots[j].hash & (unsigned int)mask);
+        int movable = (j > i) ? (home <= i || home > j) : (home <= i && home > j);
+        if (movable) {
+            registry->slots[i] = registry->slots[j];
+            i = j;
+        }
+    }
+    registry->slots[i].flight = NULL;
+
+    // O(1) unlink from the doubly linked list
+    if (flight->prev != NULL) {
+        flight->prev->next = flight->next;
+    } else {
+        registry->head = flight->next;
+    }
+    if (flight->next != NULL) {
+        flight->next->prev = flight->prev;
+    } else {
+        registry->tail = flight->prev;
+    }
+    registry->count--;
+
+    printf("✅ Flight %s deleted successfully!\n", id);
+    poolFree(registry->flightPool, flight);
+    return 1;
+}
+
+// Count flights (O(1))
+int countRegistryFlights(FlightRegistry* registry) {
+    if (registry == NULL) return 0;
+    return registry->count;
+}
+
+// Display all flights in insertion order
+void displayRegistryFlights(FlightRegistry* registry) {
+    if (registry == NULL) return;
+    displayAllFlights(registry->head);
+}
+
+// Free registry and every flight it owns (slab by slab, not flight by flight)
+void freeFlightRegistry(FlightRegistry* registry) {
+    if (registry == NULL) return;
+
+    destroyMemoryPool(registry->flightPool);
+    free(registry->slots);
+    free(registry);
+}
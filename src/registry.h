@@ -0,0 +1,36 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include "flight.h"
+
+// Flight registry: owns every flight known to the system.
+// Flights stay linked in insertion order (head/tail, doubly linked) and are
+// indexed by flightID in an open-addressing hash table (linear probing), so
+// add, find, delete and count are all O(1) on average.
+// Flights added to a registry must be allocated from its flightPool
+// (createPooledFlight), since the registry releases them through it.
+typedef struct RegistrySlot {
+    unsigned int hash;
+    Flight* flight;      // NULL means the slot is empty
+} RegistrySlot;
+
+typedef struct FlightRegistry {
+    Flight* head;
+    Flight* tail;
+    int count;
+    RegistrySlot* slots;
+    int capacity;        // always a power of two
+    MemoryPool* flightPool;
+} FlightRegistry;
+
+// Registry operations
+FlightRegistry* createFlightRegistry();
+int addFlightToRegistry(FlightRegistry* registry, Flight* flight);
+int addFlightsToRegistryBulk(FlightRegistry* registry, Flight** flights, int count);
+Flight* findFlightInRegistry(FlightRegistry* registry, const char* id);
+int deleteFlightFromRegistry(FlightRegistry* registry, const char* id);
+int countRegistryFlights(FlightRegistry* registry);
+void displayRegistryFlights(FlightRegistry* registry);
+void freeFlightRegistry(FlightRegistry* registry);
+
+#endif
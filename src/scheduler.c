@@ -1,4 +1,5 @@
 #include "scheduler.h"
+#include "simulation.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,133 +11,745 @@
     #include <unistd.h>
 #endif
 
+// Completed operations listed by the dashboard and the statistics screen
+#define DASHBOARD_RECENT_COMPLETIONS 5
+#define STATISTICS_RECENT_COMPLETIONS 20
+
+// Default options: heap queues with the default fan-out
+SchedulerConfig defaultSchedulerConfig(SchedulingAlgorithm algo) {
+    SchedulerConfig config;
+    config.algorithm = algo;
+    config.queueKind = HEAP_QUEUE;
+    config.heapArity = DEFAULT_HEAP_ARITY;
+    config.runwayCount = DEFAULT_RUNWAY_COUNT;
+    config.maxDispatchPerTick = 0;
+    config.sjfAgingRate = 0;
+    config.emergencyPreemption = 0;
+    config.takeoffRollDelay = 2;
+    config.sharedFlightRecords = 0;
+    config.completionLogCapacity = COMPLETION_LOG_DEFAULT_CAPACITY;
+    for (int i = 0; i < MAX_RUNWAYS; i++) {
+        config.runwayOperations[i] = RUNWAY_MIXED;
+    }
+    return config;
+}
+
+// Priority queue of the configured backend
+static PriorityQueue* createConfiguredQueue(FlightTable* table, SchedulerConfig config) {
+    if (config.queueKind == BUCKET_QUEUE) {
+        return createBucketPriorityQueue(table);
+    }
+    return createPriorityQueueWithArity(table, config.heapArity);
+}
+
 // Create scheduler
 Scheduler* createScheduler(SchedulingAlgorithm algo) {
+    return createSchedulerWithConfig(defaultSchedulerConfig(algo));
+}
+
+// Create scheduler with explicit options
+Scheduler* createSchedulerWithConfig(SchedulerConfig config) {
+    if (config.runwayCount < 1 || config.runwayCount > MAX_RUNWAYS) {
+        printf("❌ Runway count must be between 1 and %d!\n", MAX_RUNWAYS);
+        return NULL;
+    }
+    
     Scheduler* scheduler = (Scheduler*)malloc(sizeof(Scheduler));
     if (scheduler == NULL) {
         printf("❌ Memory allocation failed for scheduler!\n");
         return NULL;
     }
     
+    scheduler->runwayCount = config.runwayCount;
+    scheduler->runways = (Runway*)calloc(config.runwayCount, sizeof(Runway));
+    scheduler->busyRunways = (int*)malloc(sizeof(int) * config.runwayCount);
+    if (scheduler->runways == NULL || scheduler->busyRunways == NULL) {
+        printf("❌ Memory allocation failed for runways!\n");
+        free(scheduler->runways);
+        free(scheduler->busyRunways);
+        free(scheduler);
+        return NULL;
+    }
+    for (int i = 0; i < config.runwayCount; i++) {
+        // A runway without any operation would never be used
+        scheduler->runways[i].operations = config.runwayOperations[i] & RUNWAY_MIXED;
+        if (scheduler->runways[i].operations == 0) {
+            scheduler->runways[i].operations = RUNWAY_MIXED;
+        }
+    }
+    
+    scheduler->flights = createFlightTable(64);
+    if (scheduler->flights != NULL) scheduler->flights->sharedRecords = config.sharedFlightRecords;
     scheduler->landingQueue = createQueue();
     scheduler->takeoffQueue = createQueue();
-    scheduler->priorityLandingQueue = createPriorityQueue();
-    scheduler->priorityTakeoffQueue = createPriorityQueue();
-    scheduler->emergencyQueue = createPriorityQueue();
-    scheduler->completedFlights = NULL;
+    scheduler->priorityLandingQueue = createConfiguredQueue(scheduler->flights, config);
+    scheduler->priorityTakeoffQueue = createConfiguredQueue(scheduler->flights, config);
+    scheduler->sjfLandingQueue = createShortestJobQueue(scheduler->flights, config.heapArity, config.sjfAgingRate);
+    scheduler->sjfTakeoffQueue = createShortestJobQueue(scheduler->flights, config.heapArity, config.sjfAgingRate);
+    scheduler->emergencyQueue = createConfiguredQueue(scheduler->flights, config);
+    scheduler->completionLog = createCompletionLog(config.completionLogCapacity);
     scheduler->availablePilots = NULL;
     scheduler->availableAirplanes = NULL;
     scheduler->nearbyAirports = NULL;
+    scheduler->resourcePool = createMemoryPool(sizeof(Flight), 64);
+    scheduler->registry = NULL;
     scheduler->currentTime = 600;
-    scheduler->algorithm = algo;
+    scheduler->algorithm = config.algorithm;
     scheduler->totalWaitingTime = 0;
     scheduler->totalFlightsProcessed = 0;
+    scheduler->completionStats = createCompletionStats(config.runwayCount);
+    scheduler->verbose = 1;
+    scheduler->maxDispatchPerTick = config.maxDispatchPerTick;
+    scheduler->roundRobinTurn = 0;
+    scheduler->onFlightComplete = NULL;
+    scheduler->completeHookContext = NULL;
+    scheduler->emergencyPreemption = config.emergencyPreemption;
+    scheduler->takeoffRollDelay = config.takeoffRollDelay;
+    scheduler->emergencyQueuedAt = NULL;
+    scheduler->emergencyQueuedAtCapacity = 0;
+    scheduler->emergencyDispatched = 0;
+    scheduler->totalEmergencyLatency = 0;
+    scheduler->maxEmergencyLatency = 0;
+    scheduler->emergencyPreemptions = 0;
+#ifdef ENABLE_PROFILING
+    resetPhaseProfile(&scheduler->profile);
+#endif
     
     initializeRunways(scheduler);
     initializeResources(scheduler);
     return scheduler;
 }
 
-// Initialize runways
+// Initialize runways (all idle; operation masks come from the config)
 void initializeRunways(Scheduler* scheduler) {
     if (scheduler == NULL) return;
     
-    strcpy(scheduler->runways[0].name, "Runway A");
-    scheduler->runways[0].currentFlight = NULL;
-    scheduler->runways[0].availableAt = 600;
-    scheduler->runways[0].totalFlightsHandled = 0;
+    scheduler->busyCount = 0;
+    scheduler->freeRunways[LANDING] = 0;
+    scheduler->freeRunways[TAKEOFF] = 0;
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        Runway* runway = &scheduler->runways[i];
+        if (i < 26) {
+            sprintf(runway->name, "Runway %c", 'A' + i);
+        } else {
+            sprintf(runway->name, "Runway %d", i + 1);
+        }
+        runway->currentFlight = NO_FLIGHT;
+        runway->availableAt = scheduler->currentTime;
+        runway->totalFlightsHandled = 0;
+        runway->busyMinutes = 0;
+        runway->busySlot = -1;
+        if (runway->operations & RUNWAY_LANDINGS) scheduler->freeRunways[LANDING] |= 1ULL << i;
+        if (runway->operations & RUNWAY_TAKEOFFS) scheduler->freeRunways[TAKEOFF] |= 1ULL << i;
+    }
+}
+
+// Operations a runway mask accepts, for display
+const char* runwayOperationsToString(unsigned char operations) {
+    switch (operations & RUNWAY_MIXED) {
+        case RUNWAY_LANDINGS: return "Landings only";
+        case RUNWAY_TAKEOFFS: return "Takeoffs only";
+        default: return "Mixed";
+    }
+}
+
+// Move the clock (e.g. to the time of day) without waking busy runways early
+void setSchedulerTime(Scheduler* scheduler, int time) {
+    if (scheduler == NULL) return;
     
-    strcpy(scheduler->runways[1].name, "Runway B");
-    scheduler->runways[1].currentFlight = NULL;
-    scheduler->runways[1].availableAt = 600;
-    scheduler->runways[1].totalFlightsHandled = 0;
+    scheduler->currentTime = time;
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        if (scheduler->runways[i].currentFlight == NO_FLIGHT) {
+            scheduler->runways[i].availableAt = time;
+        }
+    }
 }
 
-// Add flight to appropriate queue
-void addFlightToScheduler(Scheduler* scheduler, Flight* flight) {
-    if (scheduler == NULL || flight == NULL) return;
+// Call hook(scheduler, flight, runway, context) after every completed operation
+void setFlightCompleteHook(Scheduler* scheduler, FlightCompleteHook hook, void* context) {
+    if (scheduler == NULL) return;
+    scheduler->onFlightComplete = hook;
+    scheduler->completeHookContext = context;
+}
+
+// ==================== RUNWAY AVAILABILITY ====================
+// Busy runways sit in a binary min-heap on (availableAt, index), so the next
+// completion is found in O(1) and retired in O(log R). Idle runways are bits
+// in one mask per operation; the lowest set bit is the runway to use.
+
+// Index of the lowest set bit (word must be non-zero)
+static int lowestRunway(unsigned long long word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while ((word & 1ULL) == 0) {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Heap order: earlier availableAt first, then lower runway index
+static int runwayBefore(Scheduler* scheduler, int a, int b) {
+    int timeA = scheduler->runways[a].availableAt;
+    int timeB = scheduler->runways[b].availableAt;
+    return timeA < timeB || (timeA == timeB && a < b);
+}
+
+static void placeBusyRunway(Scheduler* scheduler, int slot, int runway) {
+    scheduler->busyRunways[slot] = runway;
+    scheduler->runways[runway].busySlot = slot;
+}
+
+static void siftBusyRunway(Scheduler* scheduler, int slot) {
+    int* heap = scheduler->busyRunways;
+    int runway = heap[slot];
     
-    if (scheduler->algorithm == PRIORITY_SCHED) {
-        if (flight->operation == LANDING) {
-            insertPriorityQueue(scheduler->priorityLandingQueue, flight);
-        } else {
-            insertPriorityQueue(scheduler->priorityTakeoffQueue, flight);
+    while (slot > 0 && runwayBefore(scheduler, runway, heap[(slot - 1) / 2])) {
+        placeBusyRunway(scheduler, slot, heap[(slot - 1) / 2]);
+        slot = (slot - 1) / 2;
+    }
+    for (;;) {
+        int child = 2 * slot + 1;
+        if (child >= scheduler->busyCount) break;
+        if (child + 1 < scheduler->busyCount && runwayBefore(scheduler, heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!runwayBefore(scheduler, heap[child], runway)) break;
+        placeBusyRunway(scheduler, slot, heap[child]);
+        slot = child;
+    }
+    placeBusyRunway(scheduler, slot, runway);
+}
+
+// Runway takes a flight: leaves the free masks, enters the busy heap
+static void occupyRunway(Scheduler* scheduler, int runwayIndex) {
+    unsigned long long bit = 1ULL << runwayIndex;
+    scheduler->freeRunways[LANDING] &= ~bit;
+    scheduler->freeRunways[TAKEOFF] &= ~bit;
+    
+    if (scheduler->runways[runwayIndex].busySlot >= 0) {
+        siftBusyRunway(scheduler, scheduler->runways[runwayIndex].busySlot);
+        return;
+    }
+    placeBusyRunway(scheduler, scheduler->busyCount++, runwayIndex);
+    siftBusyRunway(scheduler, scheduler->busyCount - 1);
+}
+
+// Runway is idle again: leaves the busy heap, back into the free masks
+static void releaseRunway(Scheduler* scheduler, int runwayIndex) {
+    Runway* runway = &scheduler->runways[runwayIndex];
+    int slot = runway->busySlot;
+    if (slot >= 0) {
+        runway->busySlot = -1;
+        int last = scheduler->busyRunways[--scheduler->busyCount];
+        if (slot < scheduler->busyCount) {
+            placeBusyRunway(scheduler, slot, last);
+            siftBusyRunway(scheduler, slot);
         }
+    }
+    
+    if (runway->currentFlight != NO_FLIGHT) {
+        runway->busyMinutes += scheduler->currentTime - runway->occupiedSince;
+    }
+    runway->currentFlight = NO_FLIGHT;
+    if (runway->operations & RUNWAY_LANDINGS) scheduler->freeRunways[LANDING] |= 1ULL << runwayIndex;
+    if (runway->operations & RUNWAY_TAKEOFFS) scheduler->freeRunways[TAKEOFF] |= 1ULL << runwayIndex;
+}
+
+// Heap holding waiting flights of an operation (NULL when the algorithm uses FIFO queues)
+PriorityQueue* waitingHeapFor(Scheduler* scheduler, Operation operation) {
+    if (scheduler == NULL) return NULL;
+    
+    switch (scheduler->algorithm) {
+        case PRIORITY_SCHED:
+            return operation == LANDING ? scheduler->priorityLandingQueue : scheduler->priorityTakeoffQueue;
+        case SJF:
+            return operation == LANDING ? scheduler->sjfLandingQueue : scheduler->sjfTakeoffQueue;
+        default:
+            return NULL;
+    }
+}
+
+// Put a waiting flight in the queue for its operation
+static void queueWaitingFlight(Scheduler* scheduler, FlightIndex index) {
+    PriorityQueue* heap = waitingHeapFor(scheduler, (Operation)scheduler->flights->operation[index]);
+    if (heap != NULL) {
+        insertPriorityQueue(heap, index);
     } else {
-        if (flight->operation == LANDING) {
-            enqueue(scheduler->landingQueue, flight);
+        if (scheduler->flights->operation[index] == LANDING) {
+            enqueue(scheduler->landingQueue, index);
         } else {
-            enqueue(scheduler->takeoffQueue, flight);
+            enqueue(scheduler->takeoffQueue, index);
         }
     }
-    printf("✈️  Flight %s added to %s queue\n", 
-           flight->flightID, 
-           operationToString(flight->operation));
 }
 
-// Find available runway
-int findAvailableRunway(Scheduler* scheduler) {
-    if (scheduler == NULL) return -1;
+// Take a flight out of whichever waiting queue holds it (O(1) or O(log n))
+static int unqueueWaitingFlight(Scheduler* scheduler, FlightIndex index) {
+    return removeFromQueue(scheduler->landingQueue, index) ||
+           removeFromQueue(scheduler->takeoffQueue, index) ||
+           removeFromPriorityQueue(scheduler->priorityLandingQueue, index) ||
+           removeFromPriorityQueue(scheduler->priorityTakeoffQueue, index) ||
+           removeFromPriorityQueue(scheduler->sjfLandingQueue, index) ||
+           removeFromPriorityQueue(scheduler->sjfTakeoffQueue, index) ||
+           removeFromPriorityQueue(scheduler->emergencyQueue, index);
+}
+
+// Switch algorithms, moving every waiting flight to the new algorithm's queues
+void setSchedulingAlgorithm(Scheduler* scheduler, SchedulingAlgorithm algo) {
+    if (scheduler == NULL || algo == scheduler->algorithm) return;
+    
+    Queue* fifos[2] = {scheduler->landingQueue, scheduler->takeoffQueue};
+    PriorityQueue* heaps[4] = {scheduler->priorityLandingQueue, scheduler->priorityTakeoffQueue,
+                               scheduler->sjfLandingQueue, scheduler->sjfTakeoffQueue};
+    int waiting = fifos[0]->size + fifos[1]->size;
+    for (int i = 0; i < 4; i++) waiting += heaps[i]->size;
+    
+    FlightIndex* moved = (FlightIndex*)malloc(sizeof(FlightIndex) * (waiting > 0 ? waiting : 1));
+    if (moved == NULL) {
+        printf("❌ Memory allocation failed while changing algorithm!\n");
+        return;
+    }
     
+    // Drain in service order: FIFO queues front to back, heaps smallest key first
+    int count = 0;
     for (int i = 0; i < 2; i++) {
-        if (scheduler->runways[i].currentFlight == NULL && 
-            scheduler->runways[i].availableAt <= scheduler->currentTime) {
-            return i;
+        while (!isQueueEmpty(fifos[i])) moved[count++] = dequeue(fifos[i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        while (!isPriorityQueueEmpty(heaps[i])) moved[count++] = extractMin(heaps[i]);
+    }
+    
+    scheduler->algorithm = algo;
+    for (int i = 0; i < count; i++) {
+        queueWaitingFlight(scheduler, moved[i]);
+    }
+    free(moved);
+}
+
+// Add flight to the flight table and the appropriate queue
+FlightIndex addFlightToScheduler(Scheduler* scheduler, Flight* flight) {
+    if (scheduler == NULL || flight == NULL) return NO_FLIGHT;
+    
+    FlightIndex index = addFlightToTable(scheduler->flights, flight);
+    if (index == NO_FLIGHT) return NO_FLIGHT;
+    
+    queueWaitingFlight(scheduler, index);
+    if (scheduler->verbose) {
+        printf("✈️  Flight %s added to %s queue\n", 
+               flight->flightID, 
+               operationToString(flight->operation));
+    }
+    return index;
+}
+
+// Add a whole schedule at once: one registry pass (when the scheduler has a
+// registry), one table resize, and O(n) heap construction for the priority
+// queues. Returns the number of flights accepted; when a registry is used,
+// accepted flights end up at the front of the array (see addFlightsToRegistryBulk).
+int addFlightsToSchedulerBulk(Scheduler* scheduler, Flight** flights, int count) {
+    if (scheduler == NULL || flights == NULL || count <= 0) return 0;
+    
+    int accepted = count;
+    if (scheduler->registry != NULL) {
+        accepted = addFlightsToRegistryBulk(scheduler->registry, flights, count);
+    }
+    if (accepted == 0 || !reserveFlightTable(scheduler->flights, scheduler->flights->count + accepted)) {
+        return 0;
+    }
+    
+    // Heap-based algorithms: landings fill the batch from the front, takeoffs from the back
+    FlightIndex* batch = NULL;
+    int landings = 0, takeoffs = 0;
+    if (waitingHeapFor(scheduler, LANDING) != NULL) {
+        batch = (FlightIndex*)malloc(sizeof(FlightIndex) * accepted);
+        if (batch == NULL) {
+            printf("❌ Memory allocation failed for flight batch!\n");
+            return 0;
+        }
+    }
+    
+    for (int i = 0; i < accepted; i++) {
+        FlightIndex index = addFlightToTable(scheduler->flights, flights[i]);
+        if (index == NO_FLIGHT) continue;
+        
+        if (batch == NULL) {
+            queueWaitingFlight(scheduler, index);
+        } else if (flights[i]->operation == LANDING) {
+            batch[landings++] = index;
+        } else {
+            batch[accepted - 1 - takeoffs++] = index;
         }
     }
-    return -1; // No runway available
+    
+    if (batch != NULL) {
+        insertPriorityQueueBulk(waitingHeapFor(scheduler, LANDING), batch, landings);
+        insertPriorityQueueBulk(waitingHeapFor(scheduler, TAKEOFF), batch + accepted - takeoffs, takeoffs);
+        free(batch);
+    }
+    
+    if (scheduler->verbose) {
+        printf("✈️  %d flights added to the landing and takeoff queues\n", accepted);
+    }
+    return accepted;
 }
 
-// Assign flight to runway
-void assignFlightToRunway(Scheduler* scheduler, Flight* flight, int runwayIndex) {
-    if (scheduler == NULL || flight == NULL || runwayIndex < 0 || runwayIndex > 1) return;
+// Cancel a flight: drop it from its queue or runway and forget its record
+int cancelScheduledFlight(Scheduler* scheduler, FlightIndex index) {
+    if (scheduler == NULL || getFlightRecord(scheduler->flights, index) == NULL) return 0;
+    
+    Flight* flight = getFlightRecord(scheduler->flights, index);
+    if (scheduler->flights->status[index] == WAITING) {
+        unqueueWaitingFlight(scheduler, index);
+    } else if (scheduler->flights->status[index] == IN_PROGRESS) {
+        for (int i = 0; i < scheduler->runwayCount; i++) {
+            if (scheduler->runways[i].currentFlight == index) {
+                scheduler->runways[i].availableAt = scheduler->currentTime;
+                releaseRunway(scheduler, i);
+                if (scheduler->verbose) {
+                    printf("🛫 %s released by Flight %s\n", scheduler->runways[i].name, flight->flightID);
+                }
+            }
+        }
+    }
     
-    char timeStr[10];
-    timeToString(scheduler->currentTime, timeStr);
+    if (scheduler->flights->status[index] != COMPLETED) {
+        setFlightStatus(scheduler->flights, index, CANCELLED);
+    }
+    detachFlightRecord(scheduler->flights, index);
+    return 1;
+}
+
+// Fix a waiting flight's queue position after its hot columns changed
+// (before = its operation when it was queued)
+static void rekeyScheduledFlight(Scheduler* scheduler, FlightIndex index, Operation before) {
+    if (scheduler->flights->status[index] != WAITING) return;
+    
+    if (scheduler->flights->operation[index] != before) {
+        // Operation changed (e.g. forced landing): move to the other queue
+        if (unqueueWaitingFlight(scheduler, index)) {
+            queueWaitingFlight(scheduler, index);
+        }
+        return;
+    }
+    updatePriorityQueue(scheduler->priorityLandingQueue, index);
+    updatePriorityQueue(scheduler->priorityTakeoffQueue, index);
+    updatePriorityQueue(scheduler->sjfLandingQueue, index);
+    updatePriorityQueue(scheduler->sjfTakeoffQueue, index);
+    updatePriorityQueue(scheduler->emergencyQueue, index);
+}
+
+// Re-read a waiting flight's record after code outside the scheduler edited
+// it directly, and fix its queue position
+void refreshScheduledFlight(Scheduler* scheduler, FlightIndex index) {
+    if (scheduler == NULL || getFlightRecord(scheduler->flights, index) == NULL) return;
+    
+    Operation before = (Operation)scheduler->flights->operation[index];
+    refreshFlightFromRecord(scheduler->flights, index);
+    rekeyScheduledFlight(scheduler, index, before);
+}
+
+// Change a waiting flight's priority in place (O(log n))
+int reprioritizeFlight(Scheduler* scheduler, FlightIndex index, Priority priority) {
+    if (scheduler == NULL || getFlightRecord(scheduler->flights, index) == NULL) return 0;
+    
+    setFlightPriority(scheduler->flights, index, priority);
+    rekeyScheduledFlight(scheduler, index, (Operation)scheduler->flights->operation[index]);
+    return 1;
+}
+
+// Change a waiting flight's emergency type in place (O(log n))
+int escalateFlight(Scheduler* scheduler, FlightIndex index, EmergencyType type) {
+    if (scheduler == NULL || getFlightRecord(scheduler->flights, index) == NULL) return 0;
+    
+    setFlightEmergencyType(scheduler->flights, index, type);
+    rekeyScheduledFlight(scheduler, index, (Operation)scheduler->flights->operation[index]);
+    return 1;
+}
+
+// Row of a flight already in the scheduler's table (NO_FLIGHT if it is not)
+static FlightIndex scheduledIndex(Scheduler* scheduler, Flight* flight) {
+    return getFlightRecord(scheduler->flights, flight->tableIndex) == flight ? flight->tableIndex : NO_FLIGHT;
+}
+
+// The emergency handlers change a scheduled flight through the table setters,
+// so its hot columns stay authoritative; a flight not in the table yet only
+// has its record, which addFlightToTable loads
+static void setEmergencyProcessingTime(Scheduler* scheduler, Flight* flight, int processingTime) {
+    FlightIndex index = scheduledIndex(scheduler, flight);
+    if (index != NO_FLIGHT) {
+        setFlightProcessingTime(scheduler->flights, index, processingTime);
+    } else {
+        flight->processingTime = processingTime;
+    }
+}
+
+static void addEmergencyDelay(Scheduler* scheduler, Flight* flight, int minutes) {
+    FlightIndex index = scheduledIndex(scheduler, flight);
+    int current = index != NO_FLIGHT ? scheduler->flights->processingTime[index] : flight->processingTime;
+    setEmergencyProcessingTime(scheduler, flight, current + minutes);
+}
+
+static void setEmergencyFields(Scheduler* scheduler, Flight* flight, Operation operation, Priority priority) {
+    FlightIndex index = scheduledIndex(scheduler, flight);
+    if (index != NO_FLIGHT) {
+        setFlightOperation(scheduler->flights, index, operation);
+        setFlightPriority(scheduler->flights, index, priority);
+    } else {
+        flight->operation = operation;
+        flight->priority = priority;
+    }
+}
+
+// Find available runway (lowest idle runway of any kind)
+int findAvailableRunway(Scheduler* scheduler) {
+    if (scheduler == NULL) return -1;
     
-    scheduler->runways[runwayIndex].currentFlight = flight;
-    scheduler->runways[runwayIndex].availableAt = scheduler->currentTime + flight->processingTime;
-    flight->status = IN_PROGRESS;
+    unsigned long long idle = scheduler->freeRunways[LANDING] | scheduler->freeRunways[TAKEOFF];
+    return idle != 0 ? lowestRunway(idle) : -1;
+}
+
+// Find the lowest idle runway that accepts an operation
+int findAvailableRunwayFor(Scheduler* scheduler, Operation operation) {
+    if (scheduler == NULL) return -1;
     
+    unsigned long long idle = scheduler->freeRunways[operation == LANDING ? LANDING : TAKEOFF];
+    return idle != 0 ? lowestRunway(idle) : -1;
+}
+
+// Finish every operation whose runway time is up (earliest first)
+void completeDueOperations(Scheduler* scheduler) {
+    if (scheduler == NULL) return;
+    
+    while (scheduler->busyCount > 0 &&
+           scheduler->runways[scheduler->busyRunways[0]].availableAt <= scheduler->currentTime) {
+        completeFlightOperation(scheduler, scheduler->busyRunways[0]);
+    }
+}
+
+// Check if any flight waits for a runway
+int hasWaitingFlights(Scheduler* scheduler) {
+    if (scheduler == NULL) return 0;
+    return !isPriorityQueueEmpty(scheduler->emergencyQueue) ||
+           !isQueueEmpty(scheduler->landingQueue) ||
+           !isQueueEmpty(scheduler->takeoffQueue) ||
+           !isPriorityQueueEmpty(scheduler->priorityLandingQueue) ||
+           !isPriorityQueueEmpty(scheduler->priorityTakeoffQueue) ||
+           !isPriorityQueueEmpty(scheduler->sjfLandingQueue) ||
+           !isPriorityQueueEmpty(scheduler->sjfTakeoffQueue);
+}
+
+// Check if some idle runway accepts a waiting flight's operation
+int hasIdleRunway(Scheduler* scheduler) {
+    if (scheduler == NULL) return 0;
+    
+    int landings = !isQueueEmpty(scheduler->landingQueue) ||
+                   !isPriorityQueueEmpty(scheduler->priorityLandingQueue) ||
+                   !isPriorityQueueEmpty(scheduler->sjfLandingQueue);
+    int takeoffs = !isQueueEmpty(scheduler->takeoffQueue) ||
+                   !isPriorityQueueEmpty(scheduler->priorityTakeoffQueue) ||
+                   !isPriorityQueueEmpty(scheduler->sjfTakeoffQueue);
+    if (!isPriorityQueueEmpty(scheduler->emergencyQueue)) {
+        Operation emergency = (Operation)scheduler->flights->operation[peekMin(scheduler->emergencyQueue)];
+        if (emergency == LANDING) landings = 1; else takeoffs = 1;
+    }
+    return (landings && scheduler->freeRunways[LANDING] != 0) ||
+           (takeoffs && scheduler->freeRunways[TAKEOFF] != 0);
+}
+
+// Earliest time a busy runway finishes its flight (-1 if all are idle)
+int nextRunwayFreeTime(Scheduler* scheduler) {
+    if (scheduler == NULL || scheduler->busyCount == 0) return -1;
+    return scheduler->runways[scheduler->busyRunways[0]].availableAt;
+}
+
+// Minutes a runway has been occupied so far, including the flight on it now
+long long runwayBusyMinutes(Scheduler* scheduler, int runwayIndex) {
+    if (scheduler == NULL || runwayIndex < 0 || runwayIndex >= scheduler->runwayCount) return 0;
+    Runway* runway = &scheduler->runways[runwayIndex];
+    long long busy = runway->busyMinutes;
+    if (runway->currentFlight != NO_FLIGHT) busy += scheduler->currentTime - runway->occupiedSince;
+    return busy;
+}
+
+// Assign flight to runway
+void assignFlightToRunway(Scheduler* scheduler, FlightIndex index, int runwayIndex) {
+    if (scheduler == NULL || index == NO_FLIGHT || runwayIndex < 0 || runwayIndex >= scheduler->runwayCount) return;
+    
+    PROFILE_START(assigning);
+    scheduler->runways[runwayIndex].currentFlight = index;
+    scheduler->runways[runwayIndex].availableAt = scheduler->currentTime + scheduler->flights->processingTime[index];
+    scheduler->runways[runwayIndex].occupiedSince = scheduler->currentTime;
+    occupyRunway(scheduler, runwayIndex);
+    setFlightStatus(scheduler->flights, index, IN_PROGRESS);
+    PROFILE_STOP(&scheduler->profile, PHASE_ASSIGNMENT, assigning);
+    if (!scheduler->verbose) return;
+    
+    PROFILE_START(logging);
+    char timeStr[10];
+    timeToString(scheduler->currentTime, timeStr);
+    Flight* flight = getFlightRecord(scheduler->flights, index);
     printf("\n[Time %s] ✈️  Flight %s (%s) %s on %s... (Duration: %d min)\n",
            timeStr,
            flight->flightID,
-           flight->airline,
+           symbolToString(flight->airline),
            flight->operation == LANDING ? "landing" : "taking off",
            scheduler->runways[runwayIndex].name,
            flight->processingTime);
+    PROFILE_STOP(&scheduler->profile, PHASE_LOGGING, logging);
 }
 
 // Complete flight operation
 void completeFlightOperation(Scheduler* scheduler, int runwayIndex) {
-    if (scheduler == NULL || runwayIndex < 0 || runwayIndex > 1) return;
-    
-    Flight* flight = scheduler->runways[runwayIndex].currentFlight;
-    if (flight == NULL) return;
-    
-    char timeStr[10];
-    timeToString(scheduler->currentTime, timeStr);
-    
-    flight->status = COMPLETED;
-    printf("[Time %s] ✅ Flight %s completed %s on %s\n",
-           timeStr,
-           flight->flightID,
-           operationToString(flight->operation),
-           scheduler->runways[runwayIndex].name);
+    if (scheduler == NULL || runwayIndex < 0 || runwayIndex >= scheduler->runwayCount) return;
+    
+    FlightIndex index = scheduler->runways[runwayIndex].currentFlight;
+    if (index == NO_FLIGHT) return;
+    Flight* flight = getFlightRecord(scheduler->flights, index);
+    
+    if (scheduler->verbose) {
+        PROFILE_START(logging);
+        char timeStr[10];
+        timeToString(scheduler->currentTime, timeStr);
+        printf("[Time %s] ✅ Flight %s completed %s on %s\n",
+               timeStr,
+               flight->flightID,
+               operationToString(flight->operation),
+               scheduler->runways[runwayIndex].name);
+        PROFILE_STOP(&scheduler->profile, PHASE_LOGGING, logging);
+    }
     
-    // Add to completed flights
-    addFlight(&scheduler->completedFlights, flight);
+    PROFILE_START(completing);
+    setFlightStatus(scheduler->flights, index, COMPLETED);
+    
+    // Log a copy of the operation (the flight record itself is left alone)
+    CompletedOperation record;
+    memset(&record, 0, sizeof(record));
+    snprintf(record.flightID, sizeof(record.flightID), "%s", flight->flightID);
+    record.airline = flight->airline;
+    record.scheduledTime = scheduler->flights->scheduledTime[index];
+    record.startedAt = scheduler->runways[runwayIndex].occupiedSince;
+    record.completedAt = scheduler->currentTime;
+    record.runwayIndex = (unsigned char)runwayIndex;
+    record.operation = scheduler->flights->operation[index];
+    record.priority = scheduler->flights->priority[index];
+    record.emergencyType = scheduler->flights->emergencyType[index];
+    appendCompletion(scheduler->completionLog, &record);
     
     // Update statistics
     scheduler->runways[runwayIndex].totalFlightsHandled++;
     scheduler->totalFlightsProcessed++;
-    int waitTime = scheduler->currentTime - flight->scheduledTime;
+    // Wait: scheduled time until the runway was assigned; turnaround: until now
+    int waitTime = record.startedAt - record.scheduledTime;
+    int turnaroundTime = record.completedAt - record.scheduledTime;
     if (waitTime > 0) {
         scheduler->totalWaitingTime += waitTime;
     }
+    recordCompletedOperation(scheduler->completionStats, runwayIndex, (Operation)record.operation,
+                             (Priority)record.priority, (EmergencyType)record.emergencyType,
+                             record.airline, waitTime, turnaroundTime);
     
     // Free runway
-    scheduler->runways[runwayIndex].currentFlight = NULL;
+    releaseRunway(scheduler, runwayIndex);
+    PROFILE_STOP(&scheduler->profile, PHASE_COMPLETION, completing);
+    
+    if (scheduler->onFlightComplete != NULL) {
+        scheduler->onFlightComplete(scheduler, flight, runwayIndex, scheduler->completeHookContext);
+    }
+}
+
+// Can this scheduling pass put another flight on a runway?
+static int canDispatchMore(Scheduler* scheduler, int dispatched) {
+    if (scheduler->maxDispatchPerTick > 0 && dispatched >= scheduler->maxDispatchPerTick) return 0;
+    return (scheduler->freeRunways[LANDING] | scheduler->freeRunways[TAKEOFF]) != 0;
+}
+
+// Picks the next flight for a free runway: returns the runway (-1 when
+// nothing can be dispatched) and takes the flight off its queue
+typedef int (*FlightSelector)(Scheduler* scheduler, FlightIndex* flight);
+
+// Fill the free runways in one pass, each flight chosen by select
+static void fillFreeRunways(Scheduler* scheduler, FlightSelector select) {
+    for (int dispatched = 0; canDispatchMore(scheduler, dispatched); dispatched++) {
+        FlightIndex flight = NO_FLIGHT;
+        PROFILE_START(selecting);
+        int runwayIndex = select(scheduler, &flight);
+        PROFILE_STOP(&scheduler->profile, PHASE_SELECTION, selecting);
+        if (runwayIndex == -1) break;
+        assignFlightToRunway(scheduler, flight, runwayIndex);
+    }
+}
+
+// FCFS: landings over takeoffs (each on a runway that accepts it), in arrival order
+static int selectFCFS(Scheduler* scheduler, FlightIndex* flight) {
+    int landingRunway = findAvailableRunwayFor(scheduler, LANDING);
+    if (landingRunway != -1 && !isQueueEmpty(scheduler->landingQueue)) {
+        *flight = dequeue(scheduler->landingQueue);
+        return landingRunway;
+    }
+    int takeoffRunway = findAvailableRunwayFor(scheduler, TAKEOFF);
+    if (takeoffRunway != -1 && !isQueueEmpty(scheduler->takeoffQueue)) {
+        *flight = dequeue(scheduler->takeoffQueue);
+        return takeoffRunway;
+    }
+    return -1;
+}
+
+// Landings over takeoffs, each heap pops its best flight in O(log n)
+static int selectFromHeaps(Scheduler* scheduler, FlightIndex* flight,
+                           PriorityQueue* landings, PriorityQueue* takeoffs) {
+    int landingRunway = findAvailableRunwayFor(scheduler, LANDING);
+    if (landingRunway != -1 && !isPriorityQueueEmpty(landings)) {
+        *flight = extractMin(landings);
+        return landingRunway;
+    }
+    int takeoffRunway = findAvailableRunwayFor(scheduler, TAKEOFF);
+    if (takeoffRunway != -1 && !isPriorityQueueEmpty(takeoffs)) {
+        *flight = extractMin(takeoffs);
+        return takeoffRunway;
+    }
+    return -1;
+}
+
+// Priority: then by priority level
+static int selectPriority(Scheduler* scheduler, FlightIndex* flight) {
+    return selectFromHeaps(scheduler, flight, scheduler->priorityLandingQueue, scheduler->priorityTakeoffQueue);
+}
+
+// SJF: then shortest processing time first
+static int selectSJF(Scheduler* scheduler, FlightIndex* flight) {
+    return selectFromHeaps(scheduler, flight, scheduler->sjfLandingQueue, scheduler->sjfTakeoffQueue);
+}
+
+// Round Robin: alternate between landing and takeoff
+static int selectRoundRobin(Scheduler* scheduler, FlightIndex* flight) {
+    int landingRunway = findAvailableRunwayFor(scheduler, LANDING);
+    int takeoffRunway = findAvailableRunwayFor(scheduler, TAKEOFF);
+    int canLand = landingRunway != -1 && !isQueueEmpty(scheduler->landingQueue);
+    int canTakeOff = takeoffRunway != -1 && !isQueueEmpty(scheduler->takeoffQueue);
+    if (!canLand && !canTakeOff) return -1;
+    
+    if (scheduler->roundRobinTurn == 0) {
+        // Try landing first
+        if (canLand) {
+            scheduler->roundRobinTurn = 1;
+            *flight = dequeue(scheduler->landingQueue);
+            return landingRunway;
+        }
+        *flight = dequeue(scheduler->takeoffQueue);
+        return takeoffRunway;
+    }
+    // Try takeoff first
+    if (canTakeOff) {
+        scheduler->roundRobinTurn = 0;
+        *flight = dequeue(scheduler->takeoffQueue);
+        return takeoffRunway;
+    }
+    *flight = dequeue(scheduler->landingQueue);
+    return landingRunway;
 }
 
 // FCFS Scheduling
@@ -144,28 +757,8 @@ void scheduleFCFS(Scheduler* scheduler) {
     if (scheduler == NULL) return;
     
     // Check if any runway operations are complete
-    for (int i = 0; i < 2; i++) {
-        if (scheduler->runways[i].currentFlight != NULL &&
-            scheduler->runways[i].availableAt <= scheduler->currentTime) {
-            completeFlightOperation(scheduler, i);
-        }
-    }
-    
-    // Try to assign flights to available runways
-    int runwayIndex = findAvailableRunway(scheduler);
-    if (runwayIndex != -1) {
-        // Priority: Landing over Takeoff
-        Flight* flight = NULL;
-        if (!isQueueEmpty(scheduler->landingQueue)) {
-            flight = dequeue(scheduler->landingQueue);
-        } else if (!isQueueEmpty(scheduler->takeoffQueue)) {
-            flight = dequeue(scheduler->takeoffQueue);
-        }
-        
-        if (flight != NULL) {
-            assignFlightToRunway(scheduler, flight, runwayIndex);
-        }
-    }
+    completeDueOperations(scheduler);
+    fillFreeRunways(scheduler, selectFCFS);
 }
 
 // Priority Scheduling
@@ -173,28 +766,8 @@ void schedulePriority(Scheduler* scheduler) {
     if (scheduler == NULL) return;
     
     // Check if any runway operations are complete
-    for (int i = 0; i < 2; i++) {
-        if (scheduler->runways[i].currentFlight != NULL &&
-            scheduler->runways[i].availableAt <= scheduler->currentTime) {
-            completeFlightOperation(scheduler, i);
-        }
-    }
-    
-    // Try to assign flights to available runways
-    int runwayIndex = findAvailableRunway(scheduler);
-    if (runwayIndex != -1) {
-        Flight* flight = NULL;
-        // Priority: Landing over Takeoff, then by priority level
-        if (!isPriorityQueueEmpty(scheduler->priorityLandingQueue)) {
-            flight = extractMin(scheduler->priorityLandingQueue);
-        } else if (!isPriorityQueueEmpty(scheduler->priorityTakeoffQueue)) {
-            flight = extractMin(scheduler->priorityTakeoffQueue);
-        }
-        
-        if (flight != NULL) {
-            assignFlightToRunway(scheduler, flight, runwayIndex);
-        }
-    }
+    completeDueOperations(scheduler);
+    fillFreeRunways(scheduler, selectPriority);
 }
 
 // SJF Scheduling (Shortest processing time first)
@@ -202,104 +775,110 @@ void scheduleSJF(Scheduler* scheduler) {
     if (scheduler == NULL) return;
     
     // Check if any runway operations are complete
-    for (int i = 0; i < 2; i++) {
-        if (scheduler->runways[i].currentFlight != NULL &&
-            scheduler->runways[i].availableAt <= scheduler->currentTime) {
-            completeFlightOperation(scheduler, i);
-        }
-    }
-    
-    // Find flight with shortest processing time
-    int runwayIndex = findAvailableRunway(scheduler);
-    if (runwayIndex != -1) {
-        Flight* shortestFlight = NULL;
-        Flight* tempFlight;
-        Queue* tempQueue = createQueue();
-        
-        if (tempQueue == NULL) return;
-        
-        // Check landing queue
-        while (!isQueueEmpty(scheduler->landingQueue)) {
-            tempFlight = dequeue(scheduler->landingQueue);
-            if (shortestFlight == NULL || tempFlight->processingTime < shortestFlight->processingTime) {
-                if (shortestFlight != NULL) enqueue(tempQueue, shortestFlight);
-                shortestFlight = tempFlight;
-            } else {
-                enqueue(tempQueue, tempFlight);
-            }
-        }
-        
-        // Restore landing queue
-        while (!isQueueEmpty(tempQueue)) {
-            enqueue(scheduler->landingQueue, dequeue(tempQueue));
-        }
-        
-        // If no landing flights, check takeoff queue
-        if (shortestFlight == NULL) {
-            while (!isQueueEmpty(scheduler->takeoffQueue)) {
-                tempFlight = dequeue(scheduler->takeoffQueue);
-                if (shortestFlight == NULL || tempFlight->processingTime < shortestFlight->processingTime) {
-                    if (shortestFlight != NULL) enqueue(tempQueue, shortestFlight);
-                    shortestFlight = tempFlight;
-                } else {
-                    enqueue(tempQueue, tempFlight);
-                }
-            }
-            
-            // Restore takeoff queue
-            while (!isQueueEmpty(tempQueue)) {
-                enqueue(scheduler->takeoffQueue, dequeue(tempQueue));
-            }
-        }
-        
-        if (shortestFlight != NULL) {
-            assignFlightToRunway(scheduler, shortestFlight, runwayIndex);
-        }
-        
-        freeQueue(tempQueue);
-    }
+    completeDueOperations(scheduler);
+    fillFreeRunways(scheduler, selectSJF);
 }
 
 // Round Robin Scheduling
 void scheduleRoundRobin(Scheduler* scheduler) {
-    static int lastProcessed = 0; // 0 for landing, 1 for takeoff
-    
     if (scheduler == NULL) return;
     
     // Check if any runway operations are complete
-    for (int i = 0; i < 2; i++) {
-        if (scheduler->runways[i].currentFlight != NULL &&
-            scheduler->runways[i].availableAt <= scheduler->currentTime) {
-            completeFlightOperation(scheduler, i);
+    completeDueOperations(scheduler);
+    fillFreeRunways(scheduler, selectRoundRobin);
+}
+
+// ==================== EMERGENCY DISPATCH ====================
+
+// Put a flight in the emergency queue and note when it joined
+void queueEmergencyFlight(Scheduler* scheduler, FlightIndex index) {
+    if (scheduler == NULL || index == NO_FLIGHT) return;
+    
+    if (index >= scheduler->emergencyQueuedAtCapacity) {
+        int newCapacity = scheduler->emergencyQueuedAtCapacity > 0 ? scheduler->emergencyQueuedAtCapacity : 64;
+        while (newCapacity <= index) newCapacity *= 2;
+        int* queuedAt = (int*)realloc(scheduler->emergencyQueuedAt, sizeof(int) * newCapacity);
+        if (queuedAt == NULL) {
+            printf("❌ Memory allocation failed for emergency queue!\n");
+            return;
         }
+        scheduler->emergencyQueuedAt = queuedAt;
+        scheduler->emergencyQueuedAtCapacity = newCapacity;
+    }
+    scheduler->emergencyQueuedAt[index] = scheduler->currentTime;
+    insertPriorityQueue(scheduler->emergencyQueue, index);
+}
+
+// Busy runway accepting operation whose takeoff has not started rolling (-1 if none)
+static int findPreemptableRunway(Scheduler* scheduler, Operation operation) {
+    unsigned char accepts = operation == LANDING ? RUNWAY_LANDINGS : RUNWAY_TAKEOFFS;
+    
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        Runway* runway = &scheduler->runways[i];
+        FlightIndex current = runway->currentFlight;
+        if (current == NO_FLIGHT || !(runway->operations & accepts)) continue;
+        if (scheduler->flights->operation[current] != TAKEOFF ||
+            scheduler->flights->emergencyType[current] != NO_EMERGENCY) continue;
+        if (scheduler->currentTime < runway->occupiedSince + scheduler->takeoffRollDelay) return i;
+    }
+    return -1;
+}
+
+// Hold a takeoff short of its runway and put it back at the front of its queue
+static void preemptRunway(Scheduler* scheduler, int runwayIndex) {
+    Runway* runway = &scheduler->runways[runwayIndex];
+    FlightIndex bumped = runway->currentFlight;
+    
+    runway->availableAt = scheduler->currentTime;
+    releaseRunway(scheduler, runwayIndex);
+    setFlightStatus(scheduler->flights, bumped, WAITING);
+    
+    PriorityQueue* heap = waitingHeapFor(scheduler, TAKEOFF);
+    if (heap != NULL) {
+        insertPriorityQueue(heap, bumped);
+    } else {
+        enqueueFront(scheduler->takeoffQueue, bumped);
+    }
+    scheduler->emergencyPreemptions++;
+    
+    if (scheduler->verbose) {
+        char timeStr[10];
+        timeToString(scheduler->currentTime, timeStr);
+        printf("[Time %s] ⚠️  Flight %s held short of %s for an emergency\n",
+               timeStr, getFlightRecord(scheduler->flights, bumped)->flightID, runway->name);
     }
+}
+
+// Give emergency flights the next free runway ahead of any algorithm (in
+// emergency order); with preemption on, a takeoff that is not rolling yet
+// gives way when no runway is free
+void dispatchEmergencies(Scheduler* scheduler) {
+    if (scheduler == NULL) return;
     
-    // Try to assign flights alternating between landing and takeoff
-    int runwayIndex = findAvailableRunway(scheduler);
-    if (runwayIndex != -1) {
-        Flight* flight = NULL;
+    while (!isPriorityQueueEmpty(scheduler->emergencyQueue)) {
+        PROFILE_START(selecting);
+        FlightIndex flight = peekMin(scheduler->emergencyQueue);
+        Operation operation = (Operation)scheduler->flights->operation[flight];
         
-        if (lastProcessed == 0) {
-            // Try landing first
-            if (!isQueueEmpty(scheduler->landingQueue)) {
-                flight = dequeue(scheduler->landingQueue);
-                lastProcessed = 1;
-            } else if (!isQueueEmpty(scheduler->takeoffQueue)) {
-                flight = dequeue(scheduler->takeoffQueue);
-            }
-        } else {
-            // Try takeoff first
-            if (!isQueueEmpty(scheduler->takeoffQueue)) {
-                flight = dequeue(scheduler->takeoffQueue);
-                lastProcessed = 0;
-            } else if (!isQueueEmpty(scheduler->landingQueue)) {
-                flight = dequeue(scheduler->landingQueue);
-            }
+        int runwayIndex = findAvailableRunwayFor(scheduler, operation);
+        if (runwayIndex == -1 && scheduler->emergencyPreemption) {
+            runwayIndex = findPreemptableRunway(scheduler, operation);
+            if (runwayIndex != -1) preemptRunway(scheduler, runwayIndex);
         }
-        
-        if (flight != NULL) {
-            assignFlightToRunway(scheduler, flight, runwayIndex);
+        if (runwayIndex == -1) {
+            // Waits for the next runway that frees up (the search still counts)
+            PROFILE_STOP(&scheduler->profile, PHASE_SELECTION, selecting);
+            break;
         }
+        
+        extractMin(scheduler->emergencyQueue);
+        PROFILE_STOP(&scheduler->profile, PHASE_SELECTION, selecting);
+        int latency = scheduler->currentTime - scheduler->emergencyQueuedAt[flight];
+        scheduler->emergencyDispatched++;
+        scheduler->totalEmergencyLatency += latency;
+        if (latency > scheduler->maxEmergencyLatency) scheduler->maxEmergencyLatency = latency;
+        
+        assignFlightToRunway(scheduler, flight, runwayIndex);
     }
 }
 
@@ -307,6 +886,10 @@ void scheduleRoundRobin(Scheduler* scheduler) {
 void processScheduling(Scheduler* scheduler) {
     if (scheduler == NULL) return;
     
+    // Finished runways free up first, then emergencies take what they need
+    completeDueOperations(scheduler);
+    dispatchEmergencies(scheduler);
+    
     switch(scheduler->algorithm) {
         case FCFS:
             scheduleFCFS(scheduler);
@@ -334,14 +917,15 @@ void displayRunwayStatus(Scheduler* scheduler) {
     printf("║                        RUNWAY STATUS                          ║\n");
     printf("╚═══════════════════════════════════════════════════════════════╝\n");
     
-    for (int i = 0; i < 2; i++) {
-        printf("\n%s:\n", scheduler->runways[i].name);
-        if (scheduler->runways[i].currentFlight != NULL) {
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        printf("\n%s (%s):\n", scheduler->runways[i].name, runwayOperationsToString(scheduler->runways[i].operations));
+        if (scheduler->runways[i].currentFlight != NO_FLIGHT) {
+            Flight* flight = getFlightRecord(scheduler->flights, scheduler->runways[i].currentFlight);
             char availableStr[10];
             timeToString(scheduler->runways[i].availableAt, availableStr);
             printf("  🛫 OCCUPIED - Flight %s (%s)\n", 
-                   scheduler->runways[i].currentFlight->flightID,
-                   scheduler->runways[i].currentFlight->airline);
+                   flight->flightID,
+                   symbolToString(flight->airline));
             printf("  Available at: %s\n", availableStr);
         } else {
             printf("  ✅ AVAILABLE\n");
@@ -377,43 +961,38 @@ void displayDashboard(Scheduler* scheduler) {
     if (scheduler->algorithm == PRIORITY_SCHED) {
         displayPriorityQueue(scheduler->priorityLandingQueue, "LANDING QUEUE (Priority)");
         displayPriorityQueue(scheduler->priorityTakeoffQueue, "TAKEOFF QUEUE (Priority)");
+    } else if (scheduler->algorithm == SJF) {
+        displayPriorityQueue(scheduler->sjfLandingQueue, "LANDING QUEUE (Shortest Job)");
+        displayPriorityQueue(scheduler->sjfTakeoffQueue, "TAKEOFF QUEUE (Shortest Job)");
     } else {
-        displayQueue(scheduler->landingQueue, "LANDING QUEUE");
-        displayQueue(scheduler->takeoffQueue, "TAKEOFF QUEUE");
+        displayQueue(scheduler->landingQueue, scheduler->flights, "LANDING QUEUE");
+        displayQueue(scheduler->takeoffQueue, scheduler->flights, "TAKEOFF QUEUE");
     }
     
-    // Display completed flights count
+    // Display completed flights count and the latest few
     printf("\n📊 Total Flights Completed: %d\n", scheduler->totalFlightsProcessed);
+    for (int age = 0; age < DASHBOARD_RECENT_COMPLETIONS; age++) {
+        const CompletedOperation* record = recentCompletion(scheduler->completionLog, age);
+        if (record == NULL) break;
+        char timeStr[10];
+        timeToString(record->completedAt, timeStr);
+        printf("  %s  %-10s %-8s %s\n", timeStr, record->flightID,
+               operationToString((Operation)record->operation),
+               scheduler->runways[record->runwayIndex].name);
+    }
 }
 
-// Run simulation
+// Run simulation (event-driven, see simulation.h)
 void runSimulation(Scheduler* scheduler, int duration) {
     if (scheduler == NULL) return;
     
     printf("\n🚀 Starting simulation for %d minutes...\n\n", duration);
     sleep(1);
     
-    int endTime = scheduler->currentTime + duration;
-    
-    while (scheduler->currentTime < endTime) {
-        processScheduling(scheduler);
-        scheduler->currentTime++;
-        
-        // Small delay for visualization
-        #ifdef _WIN32
-            Sleep(100);
-        #else
-            usleep(100000);
-        #endif
-    }
-    
-    // Final processing
-    for (int i = 0; i < 2; i++) {
-        if (scheduler->runways[i].currentFlight != NULL &&
-            scheduler->runways[i].availableAt <= scheduler->currentTime) {
-            completeFlightOperation(scheduler, i);
-        }
-    }
+    // Paced for visualization: 100 ms per simulated minute
+    VirtualClock clock;
+    initVirtualClock(&clock, CLOCK_SCALED, VISUAL_SIMULATION_SPEED);
+    simulateFor(scheduler, duration, &clock);
     
     printf("\n✅ Simulation completed!\n");
 }
@@ -488,12 +1067,30 @@ void handleEmergency(Scheduler* scheduler) {
         details[strcspn(details, "\n")] = '\0';
     }
     
-    Flight* emergencyFlight = createFlight(id, airline, src, dest, 
-                                          scheduler->currentTime, 
-                                          EMERGENCY, LANDING, procTime);
+    // A flight that is already waiting is escalated in its queue, not duplicated
+    Flight* emergencyFlight = NULL;
+    if (scheduler->registry != NULL) {
+        emergencyFlight = findFlightInRegistry(scheduler->registry, id);
+        if (emergencyFlight != NULL &&
+            (emergencyFlight->status != WAITING ||
+             getFlightRecord(scheduler->flights, emergencyFlight->tableIndex) != emergencyFlight)) {
+            emergencyFlight = NULL;
+        }
+    }
+    if (emergencyFlight != NULL) {
+        printf("ℹ️  Flight %s is already scheduled - escalating it\n", id);
+    } else {
+        emergencyFlight = createPooledFlight(scheduler->resourcePool, id, airline, src, dest, 
+                                             scheduler->currentTime, 
+                                             EMERGENCY, LANDING, procTime);
+    }
     
     if (emergencyFlight != NULL) {
-        emergencyFlight->emergencyType = (EmergencyType)emergType;
+        if (scheduledIndex(scheduler, emergencyFlight) != NO_FLIGHT) {
+            setFlightEmergencyType(scheduler->flights, emergencyFlight->tableIndex, (EmergencyType)emergType);
+        } else {
+            emergencyFlight->emergencyType = (EmergencyType)emergType;
+        }
         strncpy(emergencyFlight->emergencyDetails, details, 199);
         emergencyFlight->emergencyDetails[199] = '\0';
         
@@ -527,31 +1124,79 @@ void generateStatistics(Scheduler* scheduler) {
     
     if (scheduler->totalFlightsProcessed > 0) {
         float avgWaitTime = (float)scheduler->totalWaitingTime / scheduler->totalFlightsProcessed;
-        printf("⏱️  Average Waiting Time: %.2f minutes\n", avgWaitTime);
+        printf("⏱️  Average Waiting Time: %.2f minutes (scheduled time to runway)\n", avgWaitTime);
+        if (scheduler->completionStats != NULL) {
+            MinuteSummary turnaround = summarizeSketch(&scheduler->completionStats->overall.turnaround,
+                                                       scheduler->completionStats->overall.flights);
+            printf("🔁 Average Turnaround: %.2f minutes (scheduled time to completion)\n", turnaround.mean);
+        }
     } else {
         printf("⏱️  Average Waiting Time: N/A\n");
     }
     
+    printf("\n🚨 Emergency Response:\n");
+    if (scheduler->emergencyDispatched > 0) {
+        printf("  %d emergencies given a runway, average %.2f min, worst %d min after joining the queue\n",
+               scheduler->emergencyDispatched,
+               (double)scheduler->totalEmergencyLatency / scheduler->emergencyDispatched,
+               scheduler->maxEmergencyLatency);
+    } else {
+        printf("  No emergencies dispatched\n");
+    }
+    if (scheduler->emergencyPreemptions > 0) {
+        printf("  %d takeoffs held short for an emergency\n", scheduler->emergencyPreemptions);
+    }
+    
     printf("\n🛫 Runway Utilization:\n");
-    for (int i = 0; i < 2; i++) {
-        printf("  %s: %d flights handled\n", 
+    for (int i = 0; i < scheduler->runwayCount; i++) {
+        printf("  %s: %d flights handled", 
                scheduler->runways[i].name, 
                scheduler->runways[i].totalFlightsHandled);
+        if (scheduler->completionStats != NULL && scheduler->completionStats->runways[i].flights > 0) {
+            DimensionStats* runway = &scheduler->completionStats->runways[i];
+            printf(" (wait p50 %d, p95 %d min)",
+                   sketchPercentile(&runway->wait, runway->flights, 50),
+                   sketchPercentile(&runway->wait, runway->flights, 95));
+        }
+        printf("\n");
     }
     
-    printf("\n✅ Completed Flights:\n");
-    if (scheduler->completedFlights == NULL) {
+    printf("\n🧱 Memory Pools:\n");
+    displayMemoryPoolStats(scheduler->resourcePool, "Resource pool");
+    
+#ifdef ENABLE_PROFILING
+    printf("\n⏱️  Hot-Path Phases:\n");
+    displayPhaseProfile(&scheduler->profile);
+#endif
+    
+    printf("\n✅ Completed Flights (minutes from scheduled time):\n");
+    if (scheduler->totalFlightsProcessed == 0) {
         printf("  No completed flights yet.\n");
-    } else {
-        Flight* temp = scheduler->completedFlights;
-        int count = 1;
-        while (temp != NULL) {
-            printf("  %d. %s - %s (%s)\n", 
-                   count++, temp->flightID, temp->airline, 
-                   operationToString(temp->operation));
-            temp = temp->next;
-        }
+        return;
     }
+    displayCompletionStats(scheduler->completionStats);
+    
+    // The latest completions, oldest first
+    int shown = completionLogSize(scheduler->completionLog);
+    if (shown > STATISTICS_RECENT_COMPLETIONS) shown = STATISTICS_RECENT_COMPLETIONS;
+    printf("\n  Last %d of %d:\n", shown, scheduler->totalFlightsProcessed);
+    for (int age = shown - 1; age >= 0; age--) {
+        const CompletedOperation* record = recentCompletion(scheduler->completionLog, age);
+        printf("  %lld. %s - %s (%s)\n",
+               scheduler->completionLog->total - age, record->flightID, symbolToString(record->airline),
+               operationToString((Operation)record->operation));
+    }
+}
+
+// Writes one completed operation to the report file
+static void writeLoggedCompletion(const CompletedOperation* record, long long sequence, void* context) {
+    FILE* file = (FILE*)context;
+    char completedStr[10];
+    timeToString(record->completedAt, completedStr);
+    fprintf(file, "%lld. Flight ID: %s | Airline: %s | %s | Priority: %s | Completed: %s\n",
+            sequence, record->flightID, symbolToString(record->airline),
+            operationToString((Operation)record->operation),
+            priorityToString((Priority)record->priority), completedStr);
 }
 
 // Save log to file
@@ -568,9 +1213,12 @@ void saveLogToFile(Scheduler* scheduler, const char* filename) {
     fprintf(file, "   AIRPORT RUNWAY SCHEDULING SYSTEM - OPERATION LOG\n");
     fprintf(file, "=======================================================\n\n");
     
-    time_t now;
-    time(&now);
-    fprintf(file, "Report Generated: %s\n", ctime(&now));
+    struct tm local;
+    char generated[64] = "unknown";
+    if (localTimeNow(&local)) {
+        strftime(generated, sizeof(generated), "%a %b %d %H:%M:%S %Y", &local);
+    }
+    fprintf(file, "Report Generated: %s\n\n", generated);
     
     fprintf(file, "\n--- SYSTEM CONFIGURATION ---\n");
     fprintf(file, "Scheduling Algorithm: ");
@@ -587,28 +1235,37 @@ void saveLogToFile(Scheduler* scheduler, const char* filename) {
     
     if (scheduler->totalFlightsProcessed > 0) {
         float avgWaitTime = (float)scheduler->totalWaitingTime / scheduler->totalFlightsProcessed;
-        fprintf(file, "Average Waiting Time: %.2f minutes\n", avgWaitTime);
+        fprintf(file, "Average Waiting Time: %.2f minutes (scheduled time to runway)\n", avgWaitTime);
+        if (scheduler->completionStats != NULL) {
+            MinuteSummary turnaround = summarizeSketch(&scheduler->completionStats->overall.turnaround,
+                                                       scheduler->completionStats->overall.flights);
+            fprintf(file, "Average Turnaround: %.2f minutes (scheduled time to completion)\n", turnaround.mean);
+        }
     }
     
+    fprintf(file, "Emergencies Dispatched: %d\n", scheduler->emergencyDispatched);
+    if (scheduler->emergencyDispatched > 0) {
+        fprintf(file, "Emergency Latency: %.2f minutes average, %d minutes worst\n",
+                (double)scheduler->totalEmergencyLatency / scheduler->emergencyDispatched,
+                scheduler->maxEmergencyLatency);
+    }
+    fprintf(file, "Takeoffs Preempted: %d\n", scheduler->emergencyPreemptions);
+    
     fprintf(file, "\n--- RUNWAY UTILIZATION ---\n");
-    for (int i = 0; i < 2; i++) {
+    for (int i = 0; i < scheduler->runwayCount; i++) {
         fprintf(file, "%s: %d flights handled\n", 
                scheduler->runways[i].name, 
                scheduler->runways[i].totalFlightsHandled);
     }
     
     fprintf(file, "\n--- COMPLETED FLIGHTS ---\n");
-    if (scheduler->completedFlights == NULL) {
+    if (scheduler->completionLog == NULL || scheduler->completionLog->total == 0) {
         fprintf(file, "No completed flights.\n");
     } else {
-        Flight* temp = scheduler->completedFlights;
-        int count = 1;
-        while (temp != NULL) {
-            fprintf(file, "%d. Flight ID: %s | Airline: %s | %s | Priority: %s\n", 
-                   count++, temp->flightID, temp->airline,
-                   operationToString(temp->operation),
-                   priorityToString(temp->priority));
-            temp = temp->next;
+        long long listed = visitCompletions(scheduler->completionLog, writeLoggedCompletion, file);
+        if (listed < scheduler->completionLog->total) {
+            fprintf(file, "(earlier %lld completions are no longer kept; spill the log to a file to keep them all)\n",
+                    scheduler->completionLog->total - listed);
         }
     }
     
@@ -625,31 +1282,31 @@ void initializeResources(Scheduler* scheduler) {
     if (scheduler == NULL) return;
     
     // Add sample backup pilots using Flight structure for simplicity
-    Flight* pilot1 = createFlight("PILOT001", "John Smith", "N/A", "N/A", 0, SCHEDULED, LANDING, 0);
-    Flight* pilot2 = createFlight("PILOT002", "Sarah Johnson", "N/A", "N/A", 0, SCHEDULED, LANDING, 0);
-    Flight* pilot3 = createFlight("PILOT003", "Michael Brown", "N/A", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* pilot1 = createPooledFlight(scheduler->resourcePool, "PILOT001", "John Smith", "N/A", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* pilot2 = createPooledFlight(scheduler->resourcePool, "PILOT002", "Sarah Johnson", "N/A", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* pilot3 = createPooledFlight(scheduler->resourcePool, "PILOT003", "Michael Brown", "N/A", "N/A", 0, SCHEDULED, LANDING, 0);
     
     addFlight(&scheduler->availablePilots, pilot1);
     addFlight(&scheduler->availablePilots, pilot2);
     addFlight(&scheduler->availablePilots, pilot3);
     
     // Add backup airplanes
-    Flight* plane1 = createFlight("AIRCRAFT001", "Boeing 737", "Hangar A", "N/A", 0, SCHEDULED, LANDING, 15);
-    Flight* plane2 = createFlight("AIRCRAFT002", "Airbus A320", "Hangar B", "N/A", 0, SCHEDULED, LANDING, 15);
-    Flight* plane3 = createFlight("AIRCRAFT003", "Boeing 777", "Hangar C", "N/A", 0, SCHEDULED, LANDING, 20);
+    Flight* plane1 = createPooledFlight(scheduler->resourcePool, "AIRCRAFT001", "Boeing 737", "Hangar A", "N/A", 0, SCHEDULED, LANDING, 15);
+    Flight* plane2 = createPooledFlight(scheduler->resourcePool, "AIRCRAFT002", "Airbus A320", "Hangar B", "N/A", 0, SCHEDULED, LANDING, 15);
+    Flight* plane3 = createPooledFlight(scheduler->resourcePool, "AIRCRAFT003", "Boeing 777", "Hangar C", "N/A", 0, SCHEDULED, LANDING, 20);
     
     addFlight(&scheduler->availableAirplanes, plane1);
     addFlight(&scheduler->availableAirplanes, plane2);
     addFlight(&scheduler->availableAirplanes, plane3);
     
     // Add nearby airports for emergency landing
-    Flight* airport1 = createFlight("AIRPORT001", "Delhi Airport", "Delhi", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* airport1 = createPooledFlight(scheduler->resourcePool, "AIRPORT001", "Delhi Airport", "Delhi", "N/A", 0, SCHEDULED, LANDING, 0);
     airport1->processingTime = 50; // Distance in km
-    Flight* airport2 = createFlight("AIRPORT002", "Mumbai Airport", "Mumbai", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* airport2 = createPooledFlight(scheduler->resourcePool, "AIRPORT002", "Mumbai Airport", "Mumbai", "N/A", 0, SCHEDULED, LANDING, 0);
     airport2->processingTime = 120;
-    Flight* airport3 = createFlight("AIRPORT003", "Bangalore Airport", "Bangalore", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* airport3 = createPooledFlight(scheduler->resourcePool, "AIRPORT003", "Bangalore Airport", "Bangalore", "N/A", 0, SCHEDULED, LANDING, 0);
     airport3->processingTime = 80;
-    Flight* airport4 = createFlight("AIRPORT004", "Chennai Airport", "Chennai", "N/A", 0, SCHEDULED, LANDING, 0);
+    Flight* airport4 = createPooledFlight(scheduler->resourcePool, "AIRPORT004", "Chennai Airport", "Chennai", "N/A", 0, SCHEDULED, LANDING, 0);
     airport4->processingTime = 150;
     
     addFlight(&scheduler->nearbyAirports, airport1);
@@ -717,125 +1374,152 @@ Flight* findNearestAirport(Scheduler* scheduler, Flight* flight) {
 // Handle Airplane Defect Emergency (Priority: 3)
 // DSA: Uses linked list search to find replacement aircraft
 void handleAirplaneDefect(Scheduler* scheduler, Flight* flight) {
-    printf("\n🔧 AIRPLANE DEFECT EMERGENCY\n");
-    printf("─────────────────────────────────────────────────────────────\n");
-    printf("Flight: %s (%s)\n", flight->flightID, flight->airline);
-    printf("Issue: %s\n", flight->emergencyDetails);
-    printf("\n🔍 Searching for available replacement aircraft...\n");
+    int verbose = scheduler->verbose;
+    if (verbose) {
+        printf("\n🔧 AIRPLANE DEFECT EMERGENCY\n");
+        printf("─────────────────────────────────────────────────────────────\n");
+        printf("Flight: %s (%s)\n", flight->flightID, symbolToString(flight->airline));
+        printf("Issue: %s\n", flight->emergencyDetails);
+        printf("\n🔍 Searching for available replacement aircraft...\n");
+    }
     
     Flight* replacement = findAvailableAirplane(scheduler);
     
     if (replacement != NULL) {
-        printf("✅ FOUND: %s (%s) - Ready in %d minutes\n", 
-               replacement->flightID, replacement->airline, replacement->processingTime);
-        printf("📢 ALERT: Maintenance team notified\n");
-        printf("📢 ALERT: Ground crew preparing replacement aircraft\n");
-        printf("📢 ALERT: Passengers to be transferred\n");
+        if (verbose) {
+            printf("✅ FOUND: %s (%s) - Ready in %d minutes\n", 
+                   replacement->flightID, symbolToString(replacement->airline), replacement->processingTime);
+            printf("📢 ALERT: Maintenance team notified\n");
+            printf("📢 ALERT: Ground crew preparing replacement aircraft\n");
+            printf("📢 ALERT: Passengers to be transferred\n");
+        }
         
         // Update flight processing time to include aircraft swap
-        flight->processingTime += replacement->processingTime;
+        addEmergencyDelay(scheduler, flight, replacement->processingTime);
     } else {
-        printf("❌ NO REPLACEMENT AIRCRAFT AVAILABLE\n");
-        printf("📢 ALERT: Flight delayed - waiting for aircraft from other airports\n");
-        printf("📢 ALERT: Passengers notified of delay\n");
-        flight->processingTime += 60; // Add 1 hour delay
+        if (verbose) {
+            printf("❌ NO REPLACEMENT AIRCRAFT AVAILABLE\n");
+            printf("📢 ALERT: Flight delayed - waiting for aircraft from other airports\n");
+            printf("📢 ALERT: Passengers notified of delay\n");
+        }
+        addEmergencyDelay(scheduler, flight, 60); // Add 1 hour delay
     }
     
-    printf("─────────────────────────────────────────────────────────────\n");
+    if (verbose) printf("─────────────────────────────────────────────────────────────\n");
 }
 
 // Handle Airport Delay (Priority: 1 - Lowest)
 // DSA: Simple alert system, updates timing
 void handleAirportDelay(Scheduler* scheduler, Flight* flight) {
-    printf("\n🕒 AIRPORT DELAY ALERT\n");
-    printf("─────────────────────────────────────────────────────────────\n");
-    printf("Flight: %s (%s)\n", flight->flightID, flight->airline);
-    printf("Issue: %s\n", flight->emergencyDetails);
-    printf("\n📢 ALERT: Air Traffic Control notified\n");
-    printf("📢 ALERT: Passengers informed of delay\n");
-    printf("📢 ALERT: Ground operations coordinating resolution\n");
+    if (scheduler->verbose) {
+        printf("\n🕒 AIRPORT DELAY ALERT\n");
+        printf("─────────────────────────────────────────────────────────────\n");
+        printf("Flight: %s (%s)\n", flight->flightID, symbolToString(flight->airline));
+        printf("Issue: %s\n", flight->emergencyDetails);
+        printf("\n📢 ALERT: Air Traffic Control notified\n");
+        printf("📢 ALERT: Passengers informed of delay\n");
+        printf("📢 ALERT: Ground operations coordinating resolution\n");
+    }
     
     // Add delay to processing time
-    flight->processingTime += 30; // 30 minute delay
+    addEmergencyDelay(scheduler, flight, 30); // 30 minute delay
     
-    printf("ℹ️  Estimated additional delay: 30 minutes\n");
-    printf("─────────────────────────────────────────────────────────────\n");
+    if (scheduler->verbose) {
+        printf("ℹ️  Estimated additional delay: 30 minutes\n");
+        printf("─────────────────────────────────────────────────────────────\n");
+    }
 }
 
 // Handle Pilot Unavailability (Priority: 2)
 // DSA: Uses linked list search to find replacement pilot
 void handlePilotUnavailable(Scheduler* scheduler, Flight* flight) {
-    printf("\n👨‍✈️ PILOT UNAVAILABILITY EMERGENCY\n");
-    printf("─────────────────────────────────────────────────────────────\n");
-    printf("Flight: %s (%s)\n", flight->flightID, flight->airline);
-    printf("Issue: %s\n", flight->emergencyDetails);
-    printf("\n🔍 Searching for available backup pilot...\n");
+    int verbose = scheduler->verbose;
+    if (verbose) {
+        printf("\n👨‍✈️ PILOT UNAVAILABILITY EMERGENCY\n");
+        printf("─────────────────────────────────────────────────────────────\n");
+        printf("Flight: %s (%s)\n", flight->flightID, symbolToString(flight->airline));
+        printf("Issue: %s\n", flight->emergencyDetails);
+        printf("\n🔍 Searching for available backup pilot...\n");
+    }
     
     Flight* backupPilot = findAvailablePilot(scheduler);
     
     if (backupPilot != NULL) {
-        printf("✅ FOUND: Captain %s (ID: %s)\n", 
-               backupPilot->airline, backupPilot->flightID);
-        printf("📢 ALERT: Backup pilot assigned to Flight %s\n", flight->flightID);
-        printf("📢 ALERT: Crew briefing in progress\n");
-        printf("📢 ALERT: Flight operations updated\n");
+        if (verbose) {
+            printf("✅ FOUND: Captain %s (ID: %s)\n", 
+                   symbolToString(backupPilot->airline), backupPilot->flightID);
+            printf("📢 ALERT: Backup pilot assigned to Flight %s\n", flight->flightID);
+            printf("📢 ALERT: Crew briefing in progress\n");
+            printf("📢 ALERT: Flight operations updated\n");
+        }
         
         // Small delay for pilot briefing
-        flight->processingTime += 15;
+        addEmergencyDelay(scheduler, flight, 15);
     } else {
-        printf("❌ NO BACKUP PILOT AVAILABLE\n");
-        printf("📢 ALERT: Contacting off-duty pilots\n");
-        printf("📢 ALERT: Flight delayed until pilot available\n");
-        flight->processingTime += 45; // Longer delay
+        if (verbose) {
+            printf("❌ NO BACKUP PILOT AVAILABLE\n");
+            printf("📢 ALERT: Contacting off-duty pilots\n");
+            printf("📢 ALERT: Flight delayed until pilot available\n");
+        }
+        addEmergencyDelay(scheduler, flight, 45); // Longer delay
     }
     
-    printf("─────────────────────────────────────────────────────────────\n");
+    if (verbose) printf("─────────────────────────────────────────────────────────────\n");
 }
 
 // Handle In-Flight Emergency (Priority: 4 - Highest)
 // DSA: Uses linked list search to find nearest airport
 void handleInflightEmergency(Scheduler* scheduler, Flight* flight) {
-    printf("\n🚨 IN-FLIGHT EMERGENCY - HIGHEST PRIORITY\n");
-    printf("═════════════════════════════════════════════════════════════\n");
-    printf("Flight: %s (%s)\n", flight->flightID, flight->airline);
-    printf("Route: %s → %s\n", flight->source, flight->destination);
-    printf("EMERGENCY: %s\n", flight->emergencyDetails);
-    printf("\n🆘 INITIATING EMERGENCY PROTOCOLS\n");
-    printf("─────────────────────────────────────────────────────────────\n");
-    
-    printf("🔍 Searching for nearest airport for emergency landing...\n");
+    int verbose = scheduler->verbose;
+    if (verbose) {
+        printf("\n🚨 IN-FLIGHT EMERGENCY - HIGHEST PRIORITY\n");
+        printf("═════════════════════════════════════════════════════════════\n");
+        printf("Flight: %s (%s)\n", flight->flightID, symbolToString(flight->airline));
+        printf("Route: %s → %s\n", symbolToString(flight->source), symbolToString(flight->destination));
+        printf("EMERGENCY: %s\n", flight->emergencyDetails);
+        printf("\n🆘 INITIATING EMERGENCY PROTOCOLS\n");
+        printf("─────────────────────────────────────────────────────────────\n");
+        
+        printf("🔍 Searching for nearest airport for emergency landing...\n");
+    }
     
     Flight* nearestAirport = findNearestAirport(scheduler, flight);
     
     if (nearestAirport != NULL) {
-        printf("\n✅ NEAREST AIRPORT FOUND:\n");
-        printf("   Airport: %s\n", nearestAirport->airline);
-        printf("   Location: %s\n", nearestAirport->source);
-        printf("   Distance: %d km\n", nearestAirport->processingTime);
-        printf("   ETA: ~%d minutes\n", nearestAirport->processingTime / 8);
-        
-        printf("\n📢 EMERGENCY ALERTS SENT:\n");
-        printf("   ✓ Air Traffic Control - Priority clearance granted\n");
-        printf("   ✓ Emergency services - Ambulance & fire brigade on standby\n");
-        printf("   ✓ Runway %s - Cleared for emergency landing\n", scheduler->runways[0].name);
-        printf("   ✓ Hospital - Medical team prepared\n");
-        printf("   ✓ Security - Law enforcement alerted\n");
+        if (verbose) {
+            printf("\n✅ NEAREST AIRPORT FOUND:\n");
+            printf("   Airport: %s\n", symbolToString(nearestAirport->airline));
+            printf("   Location: %s\n", symbolToString(nearestAirport->source));
+            printf("   Distance: %d km\n", nearestAirport->processingTime);
+            printf("   ETA: ~%d minutes\n", nearestAirport->processingTime / 8);
+            
+            int landingRunway = 0;
+            while (landingRunway < scheduler->runwayCount - 1 &&
+                   !(scheduler->runways[landingRunway].operations & RUNWAY_LANDINGS)) {
+                landingRunway++;
+            }
+            printf("\n📢 EMERGENCY ALERTS SENT:\n");
+            printf("   ✓ Air Traffic Control - Priority clearance granted\n");
+            printf("   ✓ Emergency services - Ambulance & fire brigade on standby\n");
+            printf("   ✓ %s - Cleared for emergency landing\n", scheduler->runways[landingRunway].name);
+            printf("   ✓ Hospital - Medical team prepared\n");
+            printf("   ✓ Security - Law enforcement alerted\n");
+        }
         
         // Change flight destination to nearest airport
-        strncpy(flight->destination, nearestAirport->source, 49);
-        flight->operation = LANDING; // Force landing operation
+        flight->destination = nearestAirport->source;
+        // Force landing operation, with immediate priority - insert at
+        // front of emergency queue
+        setEmergencyFields(scheduler, flight, LANDING, EMERGENCY);
+        setEmergencyProcessingTime(scheduler, flight, 5); // Emergency landing is faster
         
-        // Immediate priority - insert at front of emergency queue
-        flight->priority = EMERGENCY;
-        flight->processingTime = 5; // Emergency landing is faster
-        
-        printf("\n🛬 EMERGENCY LANDING SEQUENCE INITIATED\n");
-    } else {
+        if (verbose) printf("\n🛬 EMERGENCY LANDING SEQUENCE INITIATED\n");
+    } else if (verbose) {
         printf("❌ ERROR: No nearby airports found in database\n");
         printf("📢 Continuing to original destination with highest priority\n");
     }
     
-    printf("═════════════════════════════════════════════════════════════\n");
+    if (verbose) printf("═════════════════════════════════════════════════════════════\n");
 }
 
 // Handle emergency by type (Priority-based dispatch)
@@ -843,7 +1527,13 @@ void handleInflightEmergency(Scheduler* scheduler, Flight* flight) {
 void handleEmergencyByType(Scheduler* scheduler, Flight* flight) {
     if (scheduler == NULL || flight == NULL) return;
     
-    switch(flight->emergencyType) {
+    // Already in the flight table (queued flight being escalated)?
+    FlightIndex index = scheduledIndex(scheduler, flight);
+    int scheduled = index != NO_FLIGHT;
+    Operation before = scheduled ? (Operation)scheduler->flights->operation[index] : flight->operation;
+    EmergencyType type = scheduled ? (EmergencyType)scheduler->flights->emergencyType[index] : flight->emergencyType;
+    
+    switch(type) {
         case INFLIGHT_EMERGENCY:
             handleInflightEmergency(scheduler, flight);
             break;
@@ -857,13 +1547,29 @@ void handleEmergencyByType(Scheduler* scheduler, Flight* flight) {
             handleAirportDelay(scheduler, flight);
             break;
         default:
-            printf("ℹ️  No emergency for Flight %s\n", flight->flightID);
+            if (scheduler->verbose) printf("ℹ️  No emergency for Flight %s\n", flight->flightID);
             break;
     }
     
+    // Queued flights are re-keyed by handle (the handlers already updated
+    // their hot columns), then leave their regular queue for the emergency
+    // queue so every algorithm serves them first
+    if (scheduled) {
+        rekeyScheduledFlight(scheduler, index, before);
+        if (type == NO_EMERGENCY || scheduler->flights->status[index] != WAITING) {
+            if (scheduler->verbose) printf("\n✅ Flight %s re-prioritized in its queue\n", flight->flightID);
+            return;
+        }
+        unqueueWaitingFlight(scheduler, index);
+    } else if (type != NO_EMERGENCY) {
+        index = addFlightToTable(scheduler->flights, flight);
+    } else {
+        return;
+    }
+    
     // Add to emergency priority queue
-    if (flight->emergencyType != NO_EMERGENCY) {
-        insertPriorityQueue(scheduler->emergencyQueue, flight);
+    queueEmergencyFlight(scheduler, index);
+    if (scheduler->verbose) {
         printf("\n✅ Flight %s added to EMERGENCY PRIORITY QUEUE\n", flight->flightID);
     }
 }
@@ -876,10 +1582,17 @@ void freeScheduler(Scheduler* scheduler) {
     freeQueue(scheduler->takeoffQueue);
     freePriorityQueue(scheduler->priorityLandingQueue);
     freePriorityQueue(scheduler->priorityTakeoffQueue);
+    freePriorityQueue(scheduler->sjfLandingQueue);
+    freePriorityQueue(scheduler->sjfTakeoffQueue);
     freePriorityQueue(scheduler->emergencyQueue);
-    freeFlightList(&scheduler->completedFlights);
-    freeFlightList(&scheduler->availablePilots);
-    freeFlightList(&scheduler->availableAirplanes);
-    freeFlightList(&scheduler->nearbyAirports);
+    freeFlightTable(scheduler->flights);
+    free(scheduler->runways);
+    free(scheduler->busyRunways);
+    free(scheduler->emergencyQueuedAt);
+    freeCompletionStats(scheduler->completionStats);
+    freeCompletionLog(scheduler->completionLog);
+    // Flights belong to the flight registry; resources and emergency
+    // flights are released together with the scheduler's pool
+    destroyMemoryPool(scheduler->resourcePool);
     free(scheduler);
 }
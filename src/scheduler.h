@@ -3,6 +3,10 @@
 
 #include "flight.h"
 #include "queue.h"
+#include "registry.h"
+#include "profiler.h"
+#include "completion_stats.h"
+#include "completion_log.h"
 
 // Scheduling algorithms (1-based for user input)
 typedef enum {
@@ -12,37 +16,111 @@ typedef enum {
     ROUND_ROBIN = 4        // Round Robin
 } SchedulingAlgorithm;
 
+// Real-time factor of the interactive simulations (600x = 100 ms per simulated minute)
+#define VISUAL_SIMULATION_SPEED 600.0
+
+// Runways per scheduler (free runways are tracked in 64-bit masks)
+#define MAX_RUNWAYS 64
+#define DEFAULT_RUNWAY_COUNT 2
+
+// Operations a runway accepts (bit per Operation)
+#define RUNWAY_LANDINGS (1 << LANDING)
+#define RUNWAY_TAKEOFFS (1 << TAKEOFF)
+#define RUNWAY_MIXED (RUNWAY_LANDINGS | RUNWAY_TAKEOFFS)
+
+// Options fixed when a scheduler is created
+typedef struct SchedulerConfig {
+    SchedulingAlgorithm algorithm;
+    PriorityQueueKind queueKind;  // Heap, or bucket queue for high arrival rates
+    int heapArity;                // Fan-out of heap queues (2, 4 or 8)
+    int runwayCount;              // 1..MAX_RUNWAYS
+    unsigned char runwayOperations[MAX_RUNWAYS];  // RUNWAY_* mask per runway
+    int maxDispatchPerTick;       // Flights put on runways per scheduling pass (0 = fill every free runway)
+    int sjfAgingRate;             // SJF aging in 1/SJF_AGING_SCALE minutes per minute waited (0 = pure SJF)
+    int emergencyPreemption;      // Let an emergency bump a takeoff that has not started rolling
+    int takeoffRollDelay;         // Minutes after assignment before a takeoff is rolling
+    int sharedFlightRecords;      // Flights are shared with other schedulers: treat them as read-only
+    int completionLogCapacity;    // Completed operations kept in memory (the rest only in a spill file)
+} SchedulerConfig;
+
 // Runway structure
 typedef struct Runway {
     char name[20];
-    Flight* currentFlight;
+    FlightIndex currentFlight;  // NO_FLIGHT when the runway is idle
     int availableAt;  // Time when runway becomes free
     int totalFlightsHandled;
+    unsigned char operations;  // RUNWAY_* mask
+    int busySlot;  // Position in the busy-runway heap (-1 when idle)
+    int occupiedSince;  // Time the current flight was assigned
+    long long busyMinutes;  // Occupied time of flights already off the runway (completed, cancelled or held short)
 } Runway;
 
+struct Scheduler;
+
+// Called once a flight has finished on a runway (the runway is already
+// released; scheduler->currentTime is the completion time)
+typedef void (*FlightCompleteHook)(struct Scheduler* scheduler, Flight* flight, int runwayIndex, void* context);
+
 // Scheduler structure
 typedef struct Scheduler {
-    Runway runways[2];  // Two runways (A and B)
+    Runway* runways;  // runwayCount runways, named A, B, C...
+    int runwayCount;
+    int* busyRunways;  // Min-heap of occupied runways keyed on availableAt
+    int busyCount;
+    unsigned long long freeRunways[2];  // Idle runways accepting each Operation (bit per runway)
+    FlightTable* flights;  // Hot/cold flight table; queues and runways hold its indices
     Queue* landingQueue;
     Queue* takeoffQueue;
     PriorityQueue* priorityLandingQueue;
     PriorityQueue* priorityTakeoffQueue;
+    PriorityQueue* sjfLandingQueue;  // SJF: min-heaps on processing time
+    PriorityQueue* sjfTakeoffQueue;
     PriorityQueue* emergencyQueue;  // Dedicated emergency priority queue
-    Flight* completedFlights;
+    CompletionLog* completionLog;  // Records of completed operations (latest in a ring, optional spill file)
     Flight* availablePilots;  // Linked list of available pilots (stored as Flight IDs)
     Flight* availableAirplanes;  // Linked list of available airplanes
     Flight* nearbyAirports;  // Linked list of nearby airports for emergency landing
+    MemoryPool* resourcePool;  // Slab pool owning resource records and emergency flights
+    FlightRegistry* registry;  // Optional, lets emergencies escalate flights already queued
     int currentTime;
     SchedulingAlgorithm algorithm;
-    int totalWaitingTime;
+    int totalWaitingTime;  // Minutes from scheduled time to runway assignment, summed
     int totalFlightsProcessed;
+    CompletionStats* completionStats;  // Wait/turnaround aggregates, updated on every completion
+    int verbose;  // Print per-flight messages (turn off for batch loads and benchmarks)
+    int maxDispatchPerTick;  // 0 fills every free runway per pass; 1 is the old one-per-minute behaviour
+    int roundRobinTurn;  // Round Robin: 0 tries landings first next, 1 takeoffs
+    int emergencyPreemption;
+    int takeoffRollDelay;
+    // Emergency response: time from joining the emergency queue to a runway
+    int* emergencyQueuedAt;  // Flight index -> time it joined the emergency queue
+    int emergencyQueuedAtCapacity;
+    int emergencyDispatched;
+    long long totalEmergencyLatency;
+    int maxEmergencyLatency;
+    int emergencyPreemptions;
+    FlightCompleteHook onFlightComplete;  // Optional (NULL = none)
+    void* completeHookContext;
+#ifdef ENABLE_PROFILING
+    PhaseProfile profile;  // Hot-path phase latencies
+#endif
 } Scheduler;
 
 // Scheduler functions
+SchedulerConfig defaultSchedulerConfig(SchedulingAlgorithm algo);
 Scheduler* createScheduler(SchedulingAlgorithm algo);
+Scheduler* createSchedulerWithConfig(SchedulerConfig config);
 void initializeRunways(Scheduler* scheduler);
-void addFlightToScheduler(Scheduler* scheduler, Flight* flight);
+void setSchedulingAlgorithm(Scheduler* scheduler, SchedulingAlgorithm algo);
+FlightIndex addFlightToScheduler(Scheduler* scheduler, Flight* flight);
+int addFlightsToSchedulerBulk(Scheduler* scheduler, Flight** flights, int count);
+int cancelScheduledFlight(Scheduler* scheduler, FlightIndex flight);
+int reprioritizeFlight(Scheduler* scheduler, FlightIndex flight, Priority priority);
+int escalateFlight(Scheduler* scheduler, FlightIndex flight, EmergencyType type);
+void refreshScheduledFlight(Scheduler* scheduler, FlightIndex flight);
 void processScheduling(Scheduler* scheduler);
+void queueEmergencyFlight(Scheduler* scheduler, FlightIndex flight);
+void dispatchEmergencies(Scheduler* scheduler);
 void displayDashboard(Scheduler* scheduler);
 void runSimulation(Scheduler* scheduler, int duration);
 void handleEmergency(Scheduler* scheduler);
@@ -66,9 +144,19 @@ void scheduleSJF(Scheduler* scheduler);
 void scheduleRoundRobin(Scheduler* scheduler);
 
 // Helper functions
-void assignFlightToRunway(Scheduler* scheduler, Flight* flight, int runwayIndex);
+void assignFlightToRunway(Scheduler* scheduler, FlightIndex flight, int runwayIndex);
 void completeFlightOperation(Scheduler* scheduler, int runwayIndex);
 int findAvailableRunway(Scheduler* scheduler);
+int findAvailableRunwayFor(Scheduler* scheduler, Operation operation);
+void completeDueOperations(Scheduler* scheduler);
+void setSchedulerTime(Scheduler* scheduler, int time);
+void setFlightCompleteHook(Scheduler* scheduler, FlightCompleteHook hook, void* context);
+const char* runwayOperationsToString(unsigned char operations);
+PriorityQueue* waitingHeapFor(Scheduler* scheduler, Operation operation);
+int hasWaitingFlights(Scheduler* scheduler);
+int hasIdleRunway(Scheduler* scheduler);
+int nextRunwayFreeTime(Scheduler* scheduler);
+long long runwayBusyMinutes(Scheduler* scheduler, int runwayIndex);
 void displayRunwayStatus(Scheduler* scheduler);
 
 #endif
@@ -0,0 +1,226 @@
+#include "simulation.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// ==================== EVENT QUEUE ====================
+
+static int eventBefore(SimEvent* a, SimEvent* b) {
+    if (a->time != b->time) return a->time < b->time;
+    return a->sequence < b->sequence;
+}
+
+static void pushEvent(Simulation* sim, int time, SimEventType type, Flight* flight) {
+    if (sim->eventCount == sim->eventCapacity) {
+        int newCapacity = sim->eventCapacity > 0 ? sim->eventCapacity * 2 : 64;
+        SimEvent* events = (SimEvent*)realloc(sim->events, sizeof(SimEvent) * newCapacity);
+        if (events == NULL) {
+            printf("❌ Memory allocation failed for simulation events!\n");
+            return;
+        }
+        sim->events = events;
+        sim->eventCapacity = newCapacity;
+    }
+    
+    SimEvent event;
+    event.time = time;
+    event.sequence = sim->nextSequence++;
+    event.type = type;
+    event.flight = flight;
+    
+    // Sift the hole up
+    int index = sim->eventCount++;
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!eventBefore(&event, &sim->events[parent])) break;
+        sim->events[index] = sim->events[parent];
+        index = parent;
+    }
+    sim->events[index] = event;
+}
+
+static SimEvent popEvent(Simulation* sim) {
+    SimEvent top = sim->events[0];
+    SimEvent last = sim->events[--sim->eventCount];
+    
+    // Sift the hole down
+    int index = 0;
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= sim->eventCount) break;
+        if (child + 1 < sim->eventCount && eventBefore(&sim->events[child + 1], &sim->events[child])) {
+            child++;
+        }
+        if (!eventBefore(&sim->events[child], &last)) break;
+        sim->events[index] = sim->events[child];
+        index = child;
+    }
+    if (sim->eventCount > 0) sim->events[index] = last;
+    return top;
+}
+
+// ==================== ENGINE ====================
+
+// Create a simulation driving the given scheduler
+Simulation* createSimulation(Scheduler* scheduler) {
+    Simulation* sim = (Simulation*)calloc(1, sizeof(Simulation));
+    if (sim == NULL) {
+        printf("❌ Memory allocation failed for simulation!\n");
+        return NULL;
+    }
+    sim->scheduler = scheduler;
+    sim->runwayWakeAt = -1;
+    return sim;
+}
+
+// Flight joins the queues at the given time
+void scheduleArrival(Simulation* sim, Flight* flight, int time) {
+    if (sim == NULL || flight == NULL) return;
+    pushEvent(sim, time, EVENT_ARRIVAL, flight);
+}
+
+// Emergency (flight->emergencyType set) is raised at the given time
+void scheduleEmergency(Simulation* sim, Flight* flight, int time) {
+    if (sim == NULL || flight == NULL) return;
+    pushEvent(sim, time, EVENT_EMERGENCY, flight);
+}
+
+// Flights (sorted by scheduledTime) join the queues at their scheduledTime,
+// every minute's arrivals in one bulk admission. The array must outlive the
+// run; with a registry, a minute's duplicates are moved behind its accepted
+// flights. Replaces any earlier feed.
+void feedArrivals(Simulation* sim, Flight** flights, int count) {
+    if (sim == NULL) return;
+    sim->arrivals = flights;
+    sim->arrivalCount = flights != NULL && count > 0 ? count : 0;
+    sim->nextArrival = 0;
+}
+
+// Call hook on every clock move; with sampleInterval > 0 the clock also
+// stops at every multiple of it so periodic work sees each boundary
+void setSimulationHook(Simulation* sim, SimulationHook hook, void* context, int sampleInterval) {
+    if (sim == NULL) return;
+    sim->onAdvance = hook;
+    sim->hookContext = context;
+    sim->sampleInterval = sampleInterval > 0 ? sampleInterval : 0;
+}
+
+// Apply every event due at or before the current time
+static void applyDueEvents(Simulation* sim) {
+    Scheduler* scheduler = sim->scheduler;
+    
+    // Feed first: it holds the schedule, events at the same minute come after it
+    int due = sim->nextArrival;
+    while (due < sim->arrivalCount && sim->arrivals[due]->scheduledTime <= scheduler->currentTime) {
+        due++;
+    }
+    if (due > sim->nextArrival) {
+        addFlightsToSchedulerBulk(scheduler, sim->arrivals + sim->nextArrival, due - sim->nextArrival);
+        sim->eventsProcessed += due - sim->nextArrival;
+        sim->nextArrival = due;
+    }
+    
+    while (sim->eventCount > 0 && sim->events[0].time <= scheduler->currentTime) {
+        SimEvent event = popEvent(sim);
+        sim->eventsProcessed++;
+        
+        switch (event.type) {
+            case EVENT_ARRIVAL:
+                addFlightToScheduler(scheduler, event.flight);
+                break;
+            case EVENT_EMERGENCY:
+                handleEmergencyByType(scheduler, event.flight);
+                break;
+            case EVENT_RUNWAY_FREE:
+                break;    // Only wakes the engine; processScheduling completes the flight
+        }
+    }
+}
+
+// Move the clock (waiting for its wall-time deadline when paced) and notify the hook
+static void advanceClock(Simulation* sim, int toTime) {
+    int fromTime = sim->scheduler->currentTime;
+    waitForSimTime(sim->clock, toTime);
+    sim->scheduler->currentTime = toTime;
+    if (sim->onAdvance != NULL) {
+        sim->onAdvance(sim, fromTime, toTime, sim->hookContext);
+    }
+}
+
+// Run the scheduler event by event until endTime
+void runSimulationUntil(Simulation* sim, int endTime) {
+    if (sim == NULL || sim->scheduler == NULL) return;
+    Scheduler* scheduler = sim->scheduler;
+    if (sim->clock != NULL && !sim->clock->started) {
+        startVirtualClock(sim->clock, scheduler->currentTime);
+    }
+    
+    while (scheduler->currentTime < endTime) {
+        int now = scheduler->currentTime;
+        applyDueEvents(sim);
+        processScheduling(scheduler);
+        sim->steps++;
+        
+        // Make sure the next runway completion is in the event queue
+        int freeAt = nextRunwayFreeTime(scheduler);
+        if (freeAt > now && freeAt != sim->runwayWakeAt) {
+            pushEvent(sim, freeAt, EVENT_RUNWAY_FREE, NULL);
+            sim->runwayWakeAt = freeAt;
+        }
+        
+        // Next minute where processScheduling can change something
+        int next = endTime;
+        if (hasWaitingFlights(scheduler) && hasIdleRunway(scheduler)) {
+            next = now + 1;
+        }
+        if (sim->eventCount > 0 && sim->events[0].time < next) {
+            next = sim->events[0].time > now ? sim->events[0].time : now + 1;
+        }
+        if (sim->nextArrival < sim->arrivalCount && sim->arrivals[sim->nextArrival]->scheduledTime < next) {
+            int arrival = sim->arrivals[sim->nextArrival]->scheduledTime;
+            next = arrival > now ? arrival : now + 1;
+        }
+        if (sim->sampleInterval > 0) {
+            int sample = (now / sim->sampleInterval + 1) * sim->sampleInterval;
+            if (sample < next) next = sample;
+        }
+        advanceClock(sim, next);
+    }
+}
+
+// Reference mode: one processScheduling call per simulated minute
+void runSimulationTicks(Simulation* sim, int endTime) {
+    if (sim == NULL || sim->scheduler == NULL) return;
+    Scheduler* scheduler = sim->scheduler;
+    if (sim->clock != NULL && !sim->clock->started) {
+        startVirtualClock(sim->clock, scheduler->currentTime);
+    }
+    
+    while (scheduler->currentTime < endTime) {
+        applyDueEvents(sim);
+        processScheduling(scheduler);
+        sim->steps++;
+        advanceClock(sim, scheduler->currentTime + 1);
+    }
+}
+
+// Run the scheduler for duration minutes, paced by clock (NULL = as fast
+// as possible), then complete the operations that are due at the end time
+void simulateFor(Scheduler* scheduler, int duration, VirtualClock* clock) {
+    if (scheduler == NULL) return;
+    
+    Simulation* sim = createSimulation(scheduler);
+    if (sim == NULL) return;
+    sim->clock = clock;
+    runSimulationUntil(sim, scheduler->currentTime + duration);
+    freeSimulation(sim);
+    
+    // Final processing
+    completeDueOperations(scheduler);
+}
+
+// Free the simulation (flights still pending in events are not owned)
+void freeSimulation(Simulation* sim) {
+    if (sim == NULL) return;
+    free(sim->events);
+    free(sim);
+}
@@ -0,0 +1,63 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "scheduler.h"
+#include "virtual_clock.h"
+
+// Discrete-event simulation engine.
+// Instead of calling processScheduling once per simulated minute, the clock
+// jumps from one event to the next: flight arrivals, runway-free events and
+// emergency injections, kept in a min-heap ordered by (time, sequence).
+// A minute where no runway frees up, nothing arrives and no runway can take
+// a waiting flight is skipped, since processScheduling would not change
+// anything there; runs therefore give the same results as tick mode.
+// Large schedules can skip the event heap: a time-ordered arrival feed is
+// admitted minute by minute with one addFlightsToSchedulerBulk call each.
+typedef enum {
+    EVENT_ARRIVAL = 0,        // Flight joins the scheduler's queues
+    EVENT_RUNWAY_FREE = 1,    // A runway finishes its current flight
+    EVENT_EMERGENCY = 2       // Emergency raised for a flight
+} SimEventType;
+
+typedef struct SimEvent {
+    int time;
+    unsigned int sequence;    // Tie-break: events at one time run in scheduling order
+    SimEventType type;
+    Flight* flight;           // NULL for runway-free events
+} SimEvent;
+
+struct Simulation;
+
+// Called whenever the clock moves from fromTime to toTime (toTime is the new
+// scheduler->currentTime); used for pacing and periodic exports
+typedef void (*SimulationHook)(struct Simulation* sim, int fromTime, int toTime, void* context);
+
+typedef struct Simulation {
+    Scheduler* scheduler;
+    SimEvent* events;         // Binary min-heap
+    int eventCount;
+    int eventCapacity;
+    Flight** arrivals;        // Time-ordered arrival feed (not owned)
+    int arrivalCount;
+    int nextArrival;
+    unsigned int nextSequence;
+    int runwayWakeAt;         // Last runway-free time already in the heap
+    int sampleInterval;       // Also stop at every multiple of this many minutes (0 = off)
+    SimulationHook onAdvance;
+    void* hookContext;
+    VirtualClock* clock;      // Wall-time pacing (NULL = as fast as possible)
+    long eventsProcessed;
+    long steps;               // processScheduling calls
+} Simulation;
+
+Simulation* createSimulation(Scheduler* scheduler);
+void scheduleArrival(Simulation* sim, Flight* flight, int time);
+void scheduleEmergency(Simulation* sim, Flight* flight, int time);
+void feedArrivals(Simulation* sim, Flight** flights, int count);
+void setSimulationHook(Simulation* sim, SimulationHook hook, void* context, int sampleInterval);
+void runSimulationUntil(Simulation* sim, int endTime);
+void runSimulationTicks(Simulation* sim, int endTime);
+void simulateFor(Scheduler* scheduler, int duration, VirtualClock* clock);
+void freeSimulation(Simulation* sim);
+
+#endif
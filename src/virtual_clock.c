@@ -0,0 +1,110 @@
+#include "virtual_clock.h"
+#include <stdio.h>
+#include <time.h>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <unistd.h>
+    #include <sys/time.h>
+#endif
+
+// Wall time in milliseconds since the epoch
+double wallClockMs() {
+#ifdef _WIN32
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    ULARGE_INTEGER t;
+    t.LowPart = ft.dwLowDateTime;
+    t.HighPart = ft.dwHighDateTime;
+    return (double)(t.QuadPart - 116444736000000000ULL) / 10000.0;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec * 1000.0 + (double)tv.tv_usec / 1000.0;
+#endif
+}
+
+// Monotonic time in nanoseconds (only differences are meaningful)
+double monotonicNs() {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, now;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart * 1e9 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+// Current local time into out (thread-safe localtime); 0 on failure
+int localTimeNow(struct tm* out) {
+    time_t now = time(NULL);
+#ifdef _WIN32
+    return localtime_s(out, &now) == 0;
+#else
+    return localtime_r(&now, out) != NULL;
+#endif
+}
+
+// Local time of day in minutes (0-1439)
+int currentMinuteOfDay() {
+    struct tm local;
+    if (!localTimeNow(&local)) return 0;
+    return local.tm_hour * 60 + local.tm_min;
+}
+
+// Set mode and speed (speed <= 0 in scaled mode means as fast as possible)
+void initVirtualClock(VirtualClock* clock, ClockMode mode, double speed) {
+    if (clock == NULL) return;
+    
+    clock->mode = mode;
+    clock->speed = speed;
+    if (mode == CLOCK_SCALED && speed <= 0) {
+        clock->mode = CLOCK_AS_FAST_AS_POSSIBLE;
+    }
+    clock->anchorWallMs = 0;
+    clock->anchorSimTime = 0;
+    clock->started = 0;
+}
+
+// Anchor simTime to the current wall time
+void startVirtualClock(VirtualClock* clock, int simTime) {
+    if (clock == NULL) return;
+    
+    clock->anchorSimTime = simTime;
+    clock->anchorWallMs = wallClockMs();
+    if (clock->mode == CLOCK_WALL_SYNCED) {
+        // Anchor to local midnight so minute m lands on m minutes past it
+        struct tm local;
+        if (localTimeNow(&local)) {
+            double sinceMidnightMs = (local.tm_hour * 3600.0 + local.tm_min * 60.0 + local.tm_sec) * 1000.0;
+            clock->anchorWallMs -= sinceMidnightMs;
+            clock->anchorSimTime = 0;
+        }
+    }
+    clock->started = 1;
+}
+
+// Wall time at which simTime is due
+double clockDeadlineMs(VirtualClock* clock, int simTime) {
+    double minuteMs = clock->mode == CLOCK_SCALED ? 60000.0 / clock->speed : 60000.0;
+    return clock->anchorWallMs + (simTime - clock->anchorSimTime) * minuteMs;
+}
+
+// Block until simTime is due (returns at once when running behind)
+void waitForSimTime(VirtualClock* clock, int simTime) {
+    if (clock == NULL || clock->mode == CLOCK_AS_FAST_AS_POSSIBLE) return;
+    if (!clock->started) startVirtualClock(clock, simTime);
+    
+    double remainingMs = clockDeadlineMs(clock, simTime) - wallClockMs();
+    while (remainingMs > 0) {
+#ifdef _WIN32
+        Sleep((DWORD)(remainingMs + 0.5));
+#else
+        usleep((useconds_t)(remainingMs * 1000.0));
+#endif
+        remainingMs = clockDeadlineMs(clock, simTime) - wallClockMs();
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef VIRTUAL_CLOCK_H
+#define VIRTUAL_CLOCK_H
+
+#include <time.h>
+
+// Virtual clock: maps simulated minutes to wall time for paced runs.
+// Pacing waits for absolute deadlines computed from the anchor point, so
+// time spent scheduling, exporting or printing between steps is absorbed
+// instead of accumulating as drift (as a fixed sleep per step would).
+typedef enum {
+    CLOCK_AS_FAST_AS_POSSIBLE = 0,  // No waiting at all
+    CLOCK_SCALED = 1,               // speed x real time (speed 60 = one simulated minute per second)
+    CLOCK_WALL_SYNCED = 2           // Simulated minute m happens at m minutes past local midnight
+} ClockMode;
+
+typedef struct VirtualClock {
+    ClockMode mode;
+    double speed;            // Real-time factor for CLOCK_SCALED
+    double anchorWallMs;     // Wall time of the anchor
+    int anchorSimTime;       // Simulated minute at the anchor
+    int started;
+} VirtualClock;
+
+void initVirtualClock(VirtualClock* clock, ClockMode mode, double speed);
+void startVirtualClock(VirtualClock* clock, int simTime);
+double clockDeadlineMs(VirtualClock* clock, int simTime);
+void waitForSimTime(VirtualClock* clock, int simTime);
+int currentMinuteOfDay();
+int localTimeNow(struct tm* out);
+double wallClockMs();
+double monotonicNs();
+
+#endif
@@ -0,0 +1,257 @@
+#include "worker_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+    #define initLock(l) InitializeSRWLock(l)
+    #define destroyLock(l) ((void)(l))
+    #define lock(l) AcquireSRWLockExclusive(l)
+    #define unlock(l) ReleaseSRWLockExclusive(l)
+    #define initCondition(c) InitializeConditionVariable(c)
+    #define destroyCondition(c) ((void)(c))
+    #define waitCondition(c, l) SleepConditionVariableSRW(c, l, INFINITE, 0)
+    #define signalCondition(c) WakeConditionVariable(c)
+    #define broadcastCondition(c) WakeAllConditionVariable(c)
+#else
+    #define initLock(l) pthread_mutex_init(l, NULL)
+    #define destroyLock(l) pthread_mutex_destroy(l)
+    #define lock(l) pthread_mutex_lock(l)
+    #define unlock(l) pthread_mutex_unlock(l)
+    #define initCondition(c) pthread_cond_init(c, NULL)
+    #define destroyCondition(c) pthread_cond_destroy(c)
+    #define waitCondition(c, l) pthread_cond_wait(c, l)
+    #define signalCondition(c) pthread_cond_signal(c)
+    #define broadcastCondition(c) pthread_cond_broadcast(c)
+#endif
+
+// ==================== DEQUES ====================
+
+// Append at the owner's end, growing the ring when full (deque lock held)
+static int pushBottom(WorkerDeque* deque, WorkItem item) {
+    if (deque->count == deque->capacity) {
+        int newCapacity = deque->capacity > 0 ? deque->capacity * 2 : 16;
+        WorkItem* items = (WorkItem*)malloc(sizeof(WorkItem) * newCapacity);
+        if (items == NULL) return 0;
+        for (int i = 0; i < deque->count; i++) {
+            items[i] = deque->items[(deque->head + i) % deque->capacity];
+        }
+        free(deque->items);
+        deque->items = items;
+        deque->head = 0;
+        deque->capacity = newCapacity;
+    }
+    deque->items[(deque->head + deque->count) % deque->capacity] = item;
+    deque->count++;
+    return 1;
+}
+
+// Owner takes its newest task
+static int popBottom(WorkerDeque* deque, WorkItem* item) {
+    lock(&deque->lock);
+    int found = deque->count > 0;
+    if (found) {
+        deque->count--;
+        *item = deque->items[(deque->head + deque->count) % deque->capacity];
+    }
+    unlock(&deque->lock);
+    return found;
+}
+
+// Thief takes the oldest task
+static int popTop(WorkerDeque* deque, WorkItem* item) {
+    lock(&deque->lock);
+    int found = deque->count > 0;
+    if (found) {
+        *item = deque->items[deque->head];
+        deque->head = (deque->head + 1) % deque->capacity;
+        deque->count--;
+    }
+    unlock(&deque->lock);
+    return found;
+}
+
+// Own deque first, then the other workers' in order after this one
+static int takeWork(WorkerDeque* self, WorkItem* item) {
+    WorkerPool* pool = self->pool;
+    if (popBottom(self, item)) return 1;
+    for (int i = 1; i < pool->dequeCount; i++) {
+        WorkerDeque* victim = &pool->deques[(self->id + i) % pool->dequeCount];
+        if (popTop(victim, item)) {
+            self->stolen++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ==================== WORKERS ====================
+
+static void runWorker(WorkerDeque* self) {
+    WorkerPool* pool = self->pool;
+    WorkItem item;
+
+    while (1) {
+        if (takeWork(self, &item)) {
+            lock(&pool->lock);
+            pool->queued--;
+            unlock(&pool->lock);
+
+            item.run(item.arg);
+            self->executed++;
+
+            lock(&pool->lock);
+            if (--pool->pending == 0) broadcastCondition(&pool->allDone);
+            unlock(&pool->lock);
+            continue;
+        }
+
+        // Sleep until something is queued (queued can briefly count a task
+        // another worker is just taking; the loop then simply comes back)
+        lock(&pool->lock);
+        while (pool->queued == 0 && !pool->stopping) {
+            waitCondition(&pool->workReady, &pool->lock);
+        }
+        int stop = pool->stopping && pool->queued == 0;
+        unlock(&pool->lock);
+        if (stop) return;
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI workerMain(LPVOID arg) {
+    runWorker((WorkerDeque*)arg);
+    return 0;
+}
+#else
+static void* workerMain(void* arg) {
+    runWorker((WorkerDeque*)arg);
+    return NULL;
+}
+#endif
+
+// ==================== POOL ====================
+
+// Start threadCount workers (at least one)
+WorkerPool* createWorkerPool(int threadCount) {
+    if (threadCount < 1) threadCount = 1;
+
+    WorkerPool* pool = (WorkerPool*)calloc(1, sizeof(WorkerPool));
+    if (pool == NULL) {
+        printf("❌ Memory allocation failed for worker pool!\n");
+        return NULL;
+    }
+    pool->deques = (WorkerDeque*)calloc(threadCount, sizeof(WorkerDeque));
+    pool->threads = (WorkerThread*)calloc(threadCount, sizeof(WorkerThread));
+    if (pool->deques == NULL || pool->threads == NULL) {
+        printf("❌ Memory allocation failed for worker pool!\n");
+        free(pool->deques);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+
+    initLock(&pool->lock);
+    initCondition(&pool->workReady);
+    initCondition(&pool->allDone);
+    pool->dequeCount = threadCount;
+    for (int i = 0; i < threadCount; i++) {
+        pool->deques[i].pool = pool;
+        pool->deques[i].id = i;
+        initLock(&pool->deques[i].lock);
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+#ifdef _WIN32
+        pool->threads[i] = CreateThread(NULL, 0, workerMain, &pool->deques[i], 0, NULL);
+        int started = pool->threads[i] != NULL;
+#else
+        int started = pthread_create(&pool->threads[i], NULL, workerMain, &pool->deques[i]) == 0;
+#endif
+        if (!started) {
+            printf("❌ Could not start worker thread %d!\n", i + 1);
+            break;
+        }
+        pool->threadCount++;
+    }
+    if (pool->threadCount == 0) {
+        freeWorkerPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+// Queue a task; it runs on some worker, in no particular order
+void submitWork(WorkerPool* pool, WorkerTask run, void* arg) {
+    if (pool == NULL || run == NULL) return;
+    WorkItem item = {run, arg};
+
+    lock(&pool->lock);
+    WorkerDeque* deque = &pool->deques[pool->nextDeque];
+    pool->nextDeque = (pool->nextDeque + 1) % pool->threadCount;
+    pool->pending++;
+    unlock(&pool->lock);
+
+    lock(&deque->lock);
+    int pushed = pushBottom(deque, item);
+    unlock(&deque->lock);
+
+    lock(&pool->lock);
+    if (pushed) {
+        pool->queued++;
+        signalCondition(&pool->workReady);
+    } else {
+        printf("❌ Memory allocation failed for worker task!\n");
+        if (--pool->pending == 0) broadcastCondition(&pool->allDone);
+    }
+    unlock(&pool->lock);
+}
+
+// Block until every submitted task has finished
+void waitForWorkers(WorkerPool* pool) {
+    if (pool == NULL) return;
+    lock(&pool->lock);
+    while (pool->pending > 0) {
+        waitCondition(&pool->allDone, &pool->lock);
+    }
+    unlock(&pool->lock);
+}
+
+// Tasks run by a worker other than the one they were dealt to
+long countStolenTasks(WorkerPool* pool) {
+    if (pool == NULL) return 0;
+    long stolen = 0;
+    for (int i = 0; i < pool->threadCount; i++) {
+        stolen += pool->deques[i].stolen;
+    }
+    return stolen;
+}
+
+// Finish the queued tasks, stop the workers and free the pool
+void freeWorkerPool(WorkerPool* pool) {
+    if (pool == NULL) return;
+
+    lock(&pool->lock);
+    pool->stopping = 1;
+    broadcastCondition(&pool->workReady);
+    unlock(&pool->lock);
+
+    for (int i = 0; i < pool->threadCount; i++) {
+#ifdef _WIN32
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+#else
+        pthread_join(pool->threads[i], NULL);
+#endif
+    }
+
+    for (int i = 0; i < pool->dequeCount; i++) {
+        free(pool->deques[i].items);
+        destroyLock(&pool->deques[i].lock);
+    }
+    destroyLock(&pool->lock);
+    destroyCondition(&pool->workReady);
+    destroyCondition(&pool->allDone);
+    free(pool->deques);
+    free(pool->threads);
+    free(pool);
+}
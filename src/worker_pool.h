@@ -0,0 +1,64 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#ifdef _WIN32
+    #include <windows.h>
+    typedef SRWLOCK WorkerLock;
+    typedef CONDITION_VARIABLE WorkerCondition;
+    typedef HANDLE WorkerThread;
+#else
+    #include <pthread.h>
+    typedef pthread_mutex_t WorkerLock;
+    typedef pthread_cond_t WorkerCondition;
+    typedef pthread_t WorkerThread;
+#endif
+
+// Fixed-size thread pool with work stealing.
+// Every worker owns a deque of tasks behind its own lock. Submitted tasks
+// are dealt round-robin across the deques; a worker runs its own tasks
+// newest first and, when its deque is empty, steals the oldest task from
+// another worker. Uneven tasks (a busy airport next to a quiet one) are
+// therefore spread over all threads without a single shared queue that
+// every worker contends on.
+typedef void (*WorkerTask)(void* arg);
+
+typedef struct WorkItem {
+    WorkerTask run;
+    void* arg;
+} WorkItem;
+
+struct WorkerPool;
+
+typedef struct WorkerDeque {
+    WorkItem* items;          // Ring buffer
+    int head;                 // Oldest task (the end thieves take from)
+    int count;
+    int capacity;
+    WorkerLock lock;
+    struct WorkerPool* pool;
+    int id;
+    long executed;            // Tasks this worker ran
+    long stolen;              // ... of which were taken from another deque
+} WorkerDeque;
+
+typedef struct WorkerPool {
+    int threadCount;          // Workers actually running
+    WorkerThread* threads;
+    WorkerDeque* deques;
+    int dequeCount;           // Workers requested (one deque each)
+    WorkerLock lock;          // Guards the counters below
+    WorkerCondition workReady;
+    WorkerCondition allDone;
+    int queued;               // Tasks sitting in a deque
+    int pending;              // Tasks submitted and not finished yet
+    int nextDeque;            // Round-robin submission cursor
+    int stopping;
+} WorkerPool;
+
+WorkerPool* createWorkerPool(int threadCount);
+void submitWork(WorkerPool* pool, WorkerTask run, void* arg);
+void waitForWorkers(WorkerPool* pool);
+long countStolenTasks(WorkerPool* pool);
+void freeWorkerPool(WorkerPool* pool);
+
+#endif
@@ -0,0 +1,121 @@
+#include "workload.h"
+
+// Create an empty workload
+Workload* createWorkload() {
+    Workload* workload = (Workload*)calloc(1, sizeof(Workload));
+    if (workload == NULL) {
+        printf("❌ Memory allocation failed for workload!\n");
+        return NULL;
+    }
+    workload->pool = createMemoryPool(sizeof(Flight), 1024);
+    if (workload->pool == NULL) {
+        free(workload);
+        return NULL;
+    }
+    return workload;
+}
+
+// Add a regular flight arriving at time
+Flight* addWorkloadFlight(Workload* workload, const char* id, const char* airline, const char* src,
+                          const char* dest, int time, Priority priority, Operation operation,
+                          int processingTime) {
+    if (workload == NULL) return NULL;
+
+    if (workload->flightCount == workload->flightCapacity) {
+        int newCapacity = workload->flightCapacity > 0 ? workload->flightCapacity * 2 : 256;
+        Flight** flights = (Flight**)realloc(workload->flights, sizeof(Flight*) * newCapacity);
+        if (flights == NULL) {
+            printf("❌ Memory allocation failed for workload flights!\n");
+            return NULL;
+        }
+        workload->flights = flights;
+        workload->flightCapacity = newCapacity;
+    }
+
+    Flight* flight = createPooledFlight(workload->pool, id, airline, src, dest, time,
+                                       priority, operation, processingTime);
+    if (flight != NULL) {
+        workload->flights[workload->flightCount++] = flight;
+    }
+    return flight;
+}
+
+// Add an emergency of the given type raised at raisedAt
+Flight* addWorkloadEmergency(Workload* workload, const char* id, const char* airline, const char* src,
+                             const char* dest, int raisedAt, Operation operation, int processingTime,
+                             EmergencyType type) {
+    if (workload == NULL) return NULL;
+
+    if (workload->emergencyCount == workload->emergencyCapacity) {
+        int newCapacity = workload->emergencyCapacity > 0 ? workload->emergencyCapacity * 2 : 16;
+        WorkloadEmergency* emergencies = (WorkloadEmergency*)realloc(workload->emergencies,
+                                                                     sizeof(WorkloadEmergency) * newCapacity);
+        if (emergencies == NULL) {
+            printf("❌ Memory allocation failed for workload emergencies!\n");
+            return NULL;
+        }
+        workload->emergencies = emergencies;
+        workload->emergencyCapacity = newCapacity;
+    }
+
+    Flight* flight = createPooledFlight(workload->pool, id, airline, src, dest, raisedAt,
+                                       EMERGENCY, operation, processingTime);
+    if (flight != NULL) {
+        flight->emergencyType = type;
+        workload->emergencies[workload->emergencyCount].flight = flight;
+        workload->emergencies[workload->emergencyCount].raisedAt = raisedAt;
+        workload->emergencyCount++;
+    }
+    return flight;
+}
+
+// Time-ordered flights can go through the simulation's bulk arrival feed
+static int workloadInTimeOrder(Workload* workload) {
+    for (int i = 1; i < workload->flightCount; i++) {
+        if (workload->flights[i]->scheduledTime < workload->flights[i - 1]->scheduledTime) return 0;
+    }
+    return 1;
+}
+
+// Queue the whole workload on a simulation: regular flights by reference,
+// emergencies as copies allocated from emergencyPool. Returns the flights
+// queued or scheduled to arrive.
+int scheduleWorkload(Simulation* sim, Workload* workload, MemoryPool* emergencyPool) {
+    if (sim == NULL || workload == NULL || emergencyPool == NULL) return 0;
+
+    int queued = 0;
+    if (workload->preloaded) {
+        queued = addFlightsToSchedulerBulk(sim->scheduler, workload->flights, workload->flightCount);
+    } else if (workloadInTimeOrder(workload)) {
+        feedArrivals(sim, workload->flights, workload->flightCount);
+        queued = workload->flightCount;
+    } else {
+        for (int i = 0; i < workload->flightCount; i++) {
+            scheduleArrival(sim, workload->flights[i], workload->flights[i]->scheduledTime);
+            queued++;
+        }
+    }
+    for (int i = 0; i < workload->emergencyCount; i++) {
+        Flight* copy = (Flight*)poolAlloc(emergencyPool);
+        if (copy == NULL) {
+            printf("❌ Memory allocation failed for emergency flight!\n");
+            continue;
+        }
+        *copy = *workload->emergencies[i].flight;
+        copy->tableIndex = -1;
+        copy->next = NULL;
+        copy->prev = NULL;
+        scheduleEmergency(sim, copy, workload->emergencies[i].raisedAt);
+        queued++;
+    }
+    return queued;
+}
+
+// Free the workload and every flight record in it
+void freeWorkload(Workload* workload) {
+    if (workload == NULL) return;
+    destroyMemoryPool(workload->pool);
+    free(workload->flights);
+    free(workload->emergencies);
+    free(workload);
+}
@@ -0,0 +1,43 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "flight.h"
+#include "simulation.h"
+
+// A reusable set of flight arrivals and emergencies.
+// Regular flights are built once and can be handed to any number of
+// schedulers created with sharedFlightRecords, which read the records and
+// never write them. Emergency records are rewritten by the emergency
+// handlers (new destination, longer processing time...), so every run gets
+// its own copy of those; they are a small part of any workload.
+// A preloaded workload is admitted in one bulk call when the run starts
+// (like the menu's sample flights); otherwise each flight joins the queues
+// at its scheduledTime, minute by minute in bulk when the flights are in
+// time order (see feedArrivals).
+typedef struct WorkloadEmergency {
+    Flight* flight;           // Template, copied per run
+    int raisedAt;
+} WorkloadEmergency;
+
+typedef struct Workload {
+    Flight** flights;         // Regular arrivals, each joins the queues at its scheduledTime
+    int flightCount;
+    int flightCapacity;
+    int preloaded;            // Queue every flight at the start instead of at scheduledTime
+    WorkloadEmergency* emergencies;
+    int emergencyCount;
+    int emergencyCapacity;
+    MemoryPool* pool;         // Owns every record above
+} Workload;
+
+Workload* createWorkload();
+Flight* addWorkloadFlight(Workload* workload, const char* id, const char* airline, const char* src,
+                          const char* dest, int time, Priority priority, Operation operation,
+                          int processingTime);
+Flight* addWorkloadEmergency(Workload* workload, const char* id, const char* airline, const char* src,
+                             const char* dest, int raisedAt, Operation operation, int processingTime,
+                             EmergencyType type);
+int scheduleWorkload(Simulation* sim, Workload* workload, MemoryPool* emergencyPool);
+void freeWorkload(Workload* workload);
+
+#endif
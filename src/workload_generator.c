@@ -0,0 +1,222 @@
+#include "workload_generator.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct GeneratedAirline {
+    const char* code;
+    const char* name;
+} GeneratedAirline;
+
+static const GeneratedAirline generatedAirlines[] = {
+    {"AI", "AirIndia"}, {"6E", "IndiGo"}, {"SG", "SpiceJet"}, {"UK", "Vistara"}, {"G8", "GoAir"}
+};
+#define GENERATED_AIRLINE_COUNT ((int)(sizeof(generatedAirlines) / sizeof(generatedAirlines[0])))
+
+static const char* generatedAirports[] = {
+    "Delhi", "Mumbai", "Bangalore", "Kolkata", "Hyderabad", "Chennai", "Pune", "Goa"
+};
+#define GENERATED_AIRPORT_COUNT ((int)(sizeof(generatedAirports) / sizeof(generatedAirports[0])))
+
+// ==================== RANDOM NUMBERS ====================
+
+// xorshift64* seeded through splitmix64 (any seed, including 0, gives a good state)
+typedef struct GeneratorRandom {
+    unsigned long long state;
+} GeneratorRandom;
+
+static void seedRandom(GeneratorRandom* random, unsigned long long seed) {
+    unsigned long long z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    random->state = z != 0 ? z : 0x9E3779B97F4A7C15ULL;
+}
+
+static unsigned long long nextRandom(GeneratorRandom* random) {
+    unsigned long long x = random->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    random->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+// Uniform in [0, 1) with 53 bits
+static double randomUnit(GeneratorRandom* random) {
+    return (nextRandom(random) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Uniform in [0, bound)
+static int randomBelow(GeneratorRandom* random, int bound) {
+    return bound > 0 ? (int)(randomUnit(random) * bound) : 0;
+}
+
+// Index drawn in proportion to weights (0 if they are all zero)
+static int pickWeighted(GeneratorRandom* random, const double* weights, int count) {
+    double total = 0;
+    for (int i = 0; i < count; i++) {
+        if (weights[i] > 0) total += weights[i];
+    }
+    if (total <= 0) return 0;
+
+    double u = randomUnit(random) * total;
+    for (int i = 0; i < count; i++) {
+        if (weights[i] <= 0) continue;
+        if (u < weights[i]) return i;
+        u -= weights[i];
+    }
+    return count - 1;
+}
+
+static int drawProcessingTime(GeneratorRandom* random, const WorkloadSpec* spec) {
+    int time;
+    switch (spec->processing) {
+        case PROCESSING_EXPONENTIAL:
+            time = (int)(-spec->meanProcessing * log(1.0 - randomUnit(random)) + 0.5);
+            if (time < spec->minProcessing) time = spec->minProcessing;
+            if (time > spec->maxProcessing) time = spec->maxProcessing;
+            break;
+        case PROCESSING_FIXED:
+            time = (int)(spec->meanProcessing + 0.5);
+            break;
+        default:
+            time = spec->minProcessing + randomBelow(random, spec->maxProcessing - spec->minProcessing + 1);
+            break;
+    }
+    return time > 0 ? time : 1;
+}
+
+// ==================== GENERATOR ====================
+
+// Two daily peaks (08:00 and 18:00) at three times the base rate, mostly
+// scheduled traffic, 0.2% emergencies, 3-10 minutes on the runway
+WorkloadSpec defaultWorkloadSpec(int flightCount, unsigned long long seed) {
+    WorkloadSpec spec = {0};
+    spec.seed = seed;
+    spec.flightCount = flightCount;
+    spec.startTime = 0;
+    spec.endTime = 24 * 60;
+    spec.peakCount = 2;
+    spec.peakMinutes[0] = 8 * 60;
+    spec.peakMinutes[1] = 18 * 60;
+    spec.peakWidth = 90;
+    spec.peakFactor = 3.0;
+    spec.landingShare = 0.5;
+    spec.priorityWeights[0] = 0.80;
+    spec.priorityWeights[1] = 0.15;
+    spec.priorityWeights[2] = 0.05;
+    spec.emergencyShare = 0.002;
+    spec.emergencyTypeWeights[0] = 0.4;
+    spec.emergencyTypeWeights[1] = 0.3;
+    spec.emergencyTypeWeights[2] = 0.2;
+    spec.emergencyTypeWeights[3] = 0.1;
+    spec.processing = PROCESSING_UNIFORM;
+    spec.minProcessing = 3;
+    spec.maxProcessing = 10;
+    spec.meanProcessing = 6.0;
+    spec.airport = "Delhi";
+    return spec;
+}
+
+// Cumulative arrival rate per minute of [startTime, endTime)
+static double* buildRateTable(const WorkloadSpec* spec, int minutes) {
+    double* cumulative = (double*)malloc(sizeof(double) * minutes);
+    if (cumulative == NULL) {
+        printf("❌ Memory allocation failed for arrival rates!\n");
+        return NULL;
+    }
+
+    double boost = spec->peakFactor > 1.0 ? spec->peakFactor - 1.0 : 0.0;
+    double width = spec->peakWidth > 0 ? spec->peakWidth : 1;
+    int peaks = spec->peakCount < MAX_TRAFFIC_PEAKS ? spec->peakCount : MAX_TRAFFIC_PEAKS;
+    double total = 0;
+    for (int m = 0; m < minutes; m++) {
+        double rate = 1.0;
+        for (int p = 0; p < peaks; p++) {
+            double distance = (spec->startTime + m - spec->peakMinutes[p]) / width;
+            rate += boost * exp(-0.5 * distance * distance);
+        }
+        total += rate;
+        cumulative[m] = total;
+    }
+    return cumulative;
+}
+
+// Build the workload described by spec; NULL if the spec is invalid
+Workload* generateWorkload(const WorkloadSpec* spec) {
+    if (spec == NULL) return NULL;
+    if (spec->flightCount < 1 || spec->endTime <= spec->startTime || spec->startTime < 0 ||
+        spec->minProcessing > spec->maxProcessing || spec->airport == NULL) {
+        printf("❌ Invalid workload specification!\n");
+        return NULL;
+    }
+
+    int minutes = spec->endTime - spec->startTime;
+    double* cumulative = buildRateTable(spec, minutes);
+    int* perMinute = (int*)calloc(minutes, sizeof(int));
+    Workload* workload = createWorkload();
+    Flight** flights = (Flight**)malloc(sizeof(Flight*) * spec->flightCount);
+    if (cumulative == NULL || perMinute == NULL || workload == NULL || flights == NULL) {
+        free(cumulative);
+        free(perMinute);
+        free(flights);
+        freeWorkload(workload);
+        return NULL;
+    }
+    workload->flights = flights;
+    workload->flightCapacity = spec->flightCount;
+
+    GeneratorRandom random;
+    seedRandom(&random, spec->seed);
+
+    // Arrival minutes: inverse CDF of the rate, counted per minute so the
+    // flights come out in time order without sorting
+    double total = cumulative[minutes - 1];
+    for (int i = 0; i < spec->flightCount; i++) {
+        double u = randomUnit(&random) * total;
+        int low = 0, high = minutes - 1;
+        while (low < high) {
+            int mid = (low + high) / 2;
+            if (cumulative[mid] > u) high = mid;
+            else low = mid + 1;
+        }
+        perMinute[low]++;
+    }
+
+    int sequence = 0;
+    for (int m = 0; m < minutes; m++) {
+        for (int k = 0; k < perMinute[m]; k++) {
+            const GeneratedAirline* airline = &generatedAirlines[randomBelow(&random, GENERATED_AIRLINE_COUNT)];
+            int otherIndex = randomBelow(&random, GENERATED_AIRPORT_COUNT);
+            if (strcmp(generatedAirports[otherIndex], spec->airport) == 0) {
+                // Any of the other airports, never the home one
+                otherIndex = (otherIndex + 1 + randomBelow(&random, GENERATED_AIRPORT_COUNT - 1)) % GENERATED_AIRPORT_COUNT;
+            }
+            const char* other = generatedAirports[otherIndex];
+            Operation operation = randomUnit(&random) < spec->landingShare ? LANDING : TAKEOFF;
+            const char* source = operation == LANDING ? other : spec->airport;
+            const char* destination = operation == LANDING ? spec->airport : other;
+            int processingTime = drawProcessingTime(&random, spec);
+            int time = spec->startTime + m;
+
+            char id[16];
+            snprintf(id, sizeof(id), "%s%06d", airline->code, ++sequence);
+            if (randomUnit(&random) < spec->emergencyShare) {
+                EmergencyType type = (EmergencyType)(AIRPORT_DELAY +
+                    pickWeighted(&random, spec->emergencyTypeWeights, GENERATED_EMERGENCY_TYPES));
+                addWorkloadEmergency(workload, id, airline->name, source, destination, time,
+                                     operation, processingTime, type);
+            } else {
+                Priority priority = (Priority)(SCHEDULED + pickWeighted(&random, spec->priorityWeights, 3));
+                addWorkloadFlight(workload, id, airline->name, source, destination, time,
+                                  priority, operation, processingTime);
+            }
+        }
+    }
+
+    free(cumulative);
+    free(perMinute);
+    return workload;
+}
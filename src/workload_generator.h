@@ -0,0 +1,46 @@
+#ifndef WORKLOAD_GENERATOR_H
+#define WORKLOAD_GENERATOR_H
+
+#include "workload.h"
+
+#define MAX_TRAFFIC_PEAKS 4
+#define GENERATED_EMERGENCY_TYPES 4
+
+// Seeded synthetic workloads.
+// Builds flightCount flights from a seed with the generator's own PRNG, so a
+// seed gives the same workload on every platform and C library. Arrival
+// minutes follow a Poisson process whose rate rises around each traffic
+// peak (a gaussian bump of peakWidth minutes, peakFactor times the base
+// rate at its centre), conditioned on exactly flightCount arrivals. The
+// flights come out in time order, which scheduleWorkload admits minute by
+// minute through the bulk path.
+typedef enum {
+    PROCESSING_UNIFORM = 0,       // Evenly spread over [minProcessing, maxProcessing]
+    PROCESSING_EXPONENTIAL = 1,   // Mean meanProcessing, clamped to [minProcessing, maxProcessing]
+    PROCESSING_FIXED = 2          // Always meanProcessing
+} ProcessingDistribution;
+
+typedef struct WorkloadSpec {
+    unsigned long long seed;
+    int flightCount;
+    int startTime;                // Arrivals fall in [startTime, endTime)
+    int endTime;
+    int peakCount;
+    int peakMinutes[MAX_TRAFFIC_PEAKS];
+    int peakWidth;
+    double peakFactor;
+    double landingShare;          // The rest are takeoffs
+    double priorityWeights[3];    // SCHEDULED, VIP, EMERGENCY priority
+    double emergencyShare;        // Flights raised as emergencies instead
+    double emergencyTypeWeights[GENERATED_EMERGENCY_TYPES];  // AIRPORT_DELAY .. INFLIGHT_EMERGENCY
+    ProcessingDistribution processing;
+    int minProcessing;
+    int maxProcessing;
+    double meanProcessing;
+    const char* airport;          // Home airport: landings end here, takeoffs leave from here
+} WorkloadSpec;
+
+WorkloadSpec defaultWorkloadSpec(int flightCount, unsigned long long seed);
+Workload* generateWorkload(const WorkloadSpec* spec);
+
+#endif